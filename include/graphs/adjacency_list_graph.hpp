@@ -2,36 +2,66 @@
 #define ADJACENCY_LIST_GRAPH_HPP_
 
 #include <memory>
-#include <unordered_map>
+#include <optional>
 #include <vector>
+#include "graphs/adjacency_bitset.hpp"
+#include "graphs/edge_list.hpp"
 #include "graphs/graph.hpp"
+#include "graphs/slot_map.hpp"
+#include "graphs/span.hpp"
+#include "graphs/weight_traits.hpp"
 
-class AdjacencyListGraph : public Graph
+template <typename W>
+class BasicAdjacencyListGraph : public BasicGraph<W>
 {
   private:
     struct Edge
     {
         int v1, v2;
-        int weight;
+        W weight;
     };
 
-    std::unordered_map<int, int> vertices;//indeks wierzcholka i wartosc
-    std::unordered_map<int, Edge> edges;//inedks krawedzi, polaczenie waga
-    std::unordered_map<int, std::vector<int>> adjacencyList;
+    // Do 2^27 (134M) wierzcholkow i 2^27 krawedzi; wiecej rzuca std::length_error.
+    // 4 bity generacji: slot jest uzywany 16 razy, potem zostaje wycofany (zajmuje pamiec, ale nie wraca
+    // na liste wolnych), wiec przy ciaglym usuwaniu i wstawianiu tablica slotow rosnie o 1/16 liczby usuniec
+    using VertexMap = SlotMap<int, 27>;
+    using EdgeMap = SlotMap<Edge, 27>;
 
-    int nextVertexId = 0;
-    int nextEdgeId = 0;
+    VertexMap vertices;//identyfikator wierzcholka i wartosc
+    EdgeMap edges;//identyfikator krawedzi, polaczenie waga
+    std::vector<std::vector<int>> adjacencyList;//krawedzie wychodzace, po indeksie slotu wierzcholka
+    std::vector<std::vector<int>> incomingList;//krawedzie wchodzace, po indeksie slotu wierzcholka
+    std::optional<AdjacencyBitset> adjacencyBitset;//opcjonalny bit na pare (v1, v2), po indeksach slotow
+    bool directed = true;//w trybie nieskierowanym krawedz jest w adjacencyList obu koncow, incomingList nieuzywana
+
+    const std::vector<int>& outList(int v) const { return adjacencyList[VertexMap::indexOf(v)]; }
+    const std::vector<int>& inList(int v) const
+    {
+        return (directed ? incomingList : adjacencyList)[VertexMap::indexOf(v)];
+    }
+    //listy, w ktorych krawedz jest zapisana u swojego konca v2
+    std::vector<std::vector<int>>& endLists() { return directed ? incomingList : adjacencyList; }
+    void setAdjacencyBits(int v1, int v2);
 
 
   public:
+    explicit BasicAdjacencyListGraph(EdgeDirection direction = EdgeDirection::Directed)
+        : directed(direction == EdgeDirection::Directed)
+    {
+    }
+
      //metody uaktualniajace
-    int insertVertex(int val) override;
-    int insertEdge(int v1, int v2, int weight) override;
+    int insertVertex(int val = 0) override;
+    int insertEdge(int v1, int v2, W weight) override;
     void removeVertex(int v) override;
     void removeEdge(int e) override;
+    int insertVertices(int n) override;
+    int insertEdges(Span<const typename BasicGraph<W>::EdgeInput> input) override;
 
     //metody iterujace
     std::vector<int> incidentEdges(int v) const override;
+    std::vector<int> outEdges(int v) const override;
+    std::vector<int> inEdges(int v) const override;
     std::vector<int> showVertices() const override;
     std::vector<int> showEdges() const override;
   
@@ -39,12 +69,37 @@ class AdjacencyListGraph : public Graph
     //metody dostepu
     std::vector<int> endVertices(int edge) const override;
     int opposite(int v, int e) const override;
+    W edgeWeight(int e) const override;
     bool areAdjacent(int v1, int v2) const override;
     void replaceVertices(int v, int val) override;
-    void replaceEdges(int e, int weight) override;
+    void replaceEdges(int e, W weight) override;
+    bool isDirected() const override { return directed; }
 
+    //metody bez alokacji
+    int numVertices() const override { return vertices.size(); }
+    int numEdges() const override { return edges.size(); }
+    std::pair<int, int> endpoints(int e) const override;
+    void forEachVertex(FunctionRef<void(int v)> visit) const override;
+    void forEachEdge(typename BasicGraph<W>::EdgeVisitor visit) const override;
+    void forEachOutNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const override;
+    void forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const override;
+    // Widok na identyfikatory krawedzi wychodzacych z v, wazny do nastepnej modyfikacji grafu
+    Span<const int> outEdgeIds(int v) const;
 
-    static std::unique_ptr<Graph> createGraph(std::istream& is);
+
+    //indeks bitowy sasiedztwa: O(1) areAdjacent i operacje na zbiorach nastepnikow
+    void enableAdjacencyBitset();
+    void disableAdjacencyBitset();
+    bool hasAdjacencyBitset() const { return adjacencyBitset.has_value(); }
+    int commonNeighborCount(int v1, int v2) const;
+    int neighborUnionCount(int v1, int v2) const;
+    std::vector<int> commonNeighbors(int v1, int v2) const;
+
+    // W trybie Undirected para krawedzi (v1, v2, w) i (v2, v1, w) z wejscia jest zapisywana jako jedna krawedz
+    static std::unique_ptr<BasicGraph<W>> createGraph(std::istream& is,
+                                                      EdgeDirection direction = EdgeDirection::Directed);
+    static std::unique_ptr<BasicGraph<W>> createGraph(const BasicEdgeList<W>& edgeList,
+                                                      EdgeDirection direction = EdgeDirection::Directed);
 
     void printGraph() const override;
 
@@ -52,4 +107,10 @@ class AdjacencyListGraph : public Graph
 
 };
 
+#define GRAPHS_DECLARE_LIST_GRAPH(W) extern template class BasicAdjacencyListGraph<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_LIST_GRAPH)
+#undef GRAPHS_DECLARE_LIST_GRAPH
+
+using AdjacencyListGraph = BasicAdjacencyListGraph<int>;
+
 #endif /* ADJACENCY_LIST_GRAPH_HPP_ */
@@ -2,47 +2,105 @@
 #define ADJACENCY_MATRIX_GRAPH_HPP_
 
 #include <memory>
-#include <unordered_map>
+#include <vector>
+#include "graphs/edge_list.hpp"
 #include "graphs/graph.hpp"
-#include <climits>
-class AdjacencyMatrixGraph : public Graph
+#include "graphs/slot_map.hpp"
+#include "graphs/weight_traits.hpp"
+
+template <typename W>
+class BasicAdjacencyMatrixGraph : public BasicGraph<W>
 {
     struct Edge{
         int v1;
         int v2;
-        int weight;
+        W weight;
     };
 
 
   private:
-    std::vector<std::vector<int>> adjacencyMatrix;
-    std::unordered_map<int, int> vertices;            
-    std::unordered_map<int, Edge> edges; 
-    int nextVertexIndex = 0;
-    int nextEdgeIndex = 0;
-    static int const INF = INT_MAX;
+    // Macierz identyfikatorow krawedzi (NO_EDGE, gdy brak krawedzi) przechowywana wierszami w jednym buforze
+    // capacity x capacity, pojemnosc rosnie dwukrotnie, gdy brakuje miejsca na nowy wierzcholek.
+    // Krawedzie incydentne to skan wiersza i kolumny, a waga jest czytana z mapy edges po identyfikatorze,
+    // wiec pole macierzy ma 4 bajty niezaleznie od W (typ wag zmniejsza tylko rekordy krawedzi).
+    std::vector<int> edgeIdMatrix;
+    int capacity = 0;
+    // Do 2^24 wierzcholkow (macierz V^2 i tak konczy sie wczesniej) i 2^27 (134M) krawedzi;
+    // slot krawedzi jest uzywany 16 razy (4 bity generacji), potem zostaje wycofany
+    using VertexMap = SlotMap<int, 24>;
+    using EdgeMap = SlotMap<Edge, 27>;
+
+    // Wiersz / kolumna macierzy to indeks slotu wierzcholka w vertices
+    VertexMap vertices;
+    EdgeMap edges;
+    static constexpr int NO_EDGE = -1;
+    // W grafie nieskierowanym krawedz zajmuje pola (v1, v2) i (v2, v1) z tym samym identyfikatorem
+    bool directed = true;
+
+    static int slotOf(int v) { return VertexMap::indexOf(v); }
+    int slotCount() const { return vertices.slotCount(); }
+    std::size_t position(int row, int col) const { return static_cast<std::size_t>(row) * capacity + col; }
+    int& edgeCell(int row, int col) { return edgeIdMatrix[position(row, col)]; }
+    int edgeCell(int row, int col) const { return edgeIdMatrix[position(row, col)]; }
+    W weightOf(int edgeId) const { return edges.valueAt(EdgeMap::indexOf(edgeId)).weight; }
+    void growTo(int newCapacity);
+    void eraseEdgeAt(int row, int col);
+    int placeEdge(int v1, int v2, W weight, bool append);
   public:
+    explicit BasicAdjacencyMatrixGraph(EdgeDirection direction = EdgeDirection::Directed)
+        : directed(direction == EdgeDirection::Directed)
+    {
+    }
+
+    // Rezerwuje miejsce na vertexCount wierzcholkow (jedna alokacja)
+    void reserve(int vertexCount);
+
     // Update methods
-    int insertVertex(int val) override;
-    int insertEdge(int v1, int v2, int weight) override;
+    int insertVertex(int val = 0) override;
+    int insertEdge(int v1, int v2, W weight) override;
     void removeVertex(int v) override;
     void removeEdge(int e) override;
+    int insertVertices(int n) override;
+    int insertEdges(Span<const typename BasicGraph<W>::EdgeInput> input) override;
 
     // Iteration methods
     std::vector<int> showVertices() const override;
     std::vector<int> showEdges() const override;
     std::vector<int> incidentEdges(int v) const override;
+    std::vector<int> outEdges(int v) const override;
+    std::vector<int> inEdges(int v) const override;
 
     // Access methods
     std::vector<int> endVertices(int edge) const override;
     bool areAdjacent(int v1, int v2) const override;
     int opposite(int v, int e) const override;
+    W edgeWeight(int e) const override;
     void replaceVertices(int v, int val) override;
-    void replaceEdges(int e, int weight) override;
+    void replaceEdges(int e, W weight) override;
+    bool isDirected() const override { return directed; }
+
+    // Non-allocating access methods
+    int numVertices() const override { return vertices.size(); }
+    int numEdges() const override { return edges.size(); }
+    std::pair<int, int> endpoints(int e) const override;
+    void forEachVertex(FunctionRef<void(int v)> visit) const override;
+    void forEachEdge(typename BasicGraph<W>::EdgeVisitor visit) const override;
+    void forEachOutNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const override;
+    void forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const override;
 
     void printGraph() const override;
 
-    static std::unique_ptr<Graph> createGraph(std::istream& is);
+    // W trybie Undirected para krawedzi (v1, v2, w) i (v2, v1, w) z wejscia jest zapisywana jako jedna krawedz
+    static std::unique_ptr<BasicGraph<W>> createGraph(std::istream& is,
+                                                      EdgeDirection direction = EdgeDirection::Directed);
+    static std::unique_ptr<BasicGraph<W>> createGraph(const BasicEdgeList<W>& edgeList,
+                                                      EdgeDirection direction = EdgeDirection::Directed);
 };
 
+#define GRAPHS_DECLARE_MATRIX_GRAPH(W) extern template class BasicAdjacencyMatrixGraph<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_MATRIX_GRAPH)
+#undef GRAPHS_DECLARE_MATRIX_GRAPH
+
+using AdjacencyMatrixGraph = BasicAdjacencyMatrixGraph<int>;
+
 #endif /* ADJACENCY_MATRIX_GRAPH_HPP_ */
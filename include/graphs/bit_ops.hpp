@@ -0,0 +1,44 @@
+#ifndef BIT_OPS_HPP_
+#define BIT_OPS_HPP_
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Liczba ustawionych bitow slowa
+inline int popcount(std::uint64_t word)
+{
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt64(word));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+// Indeks najmlodszego ustawionego bitu; word nie moze byc zerem
+inline int countTrailingZeros(std::uint64_t word)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+// Indeks najstarszego ustawionego bitu; word nie moze byc zerem
+inline int highestBit(std::uint64_t word)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(word);
+#endif
+}
+
+#endif /* BIT_OPS_HPP_ */
@@ -0,0 +1,212 @@
+#ifndef BUCKET_QUEUES_HPP_
+#define BUCKET_QUEUES_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "graphs/bit_ops.hpp"
+
+/*
+ * Kolejka kubelkowa Diala dla elementow 0..capacity-1 z nieujemnymi kluczami calkowitymi.
+ * Wymaga, aby wszystkie klucze w kolejce miescily sie w [min, min + maxStep] (Dijkstra z wagami
+ * 0..maxStep), wiec wystarcza maxStep + 1 kubelkow uzywanych cyklicznie: kubelek key % (maxStep + 1).
+ * Kubelki to listy dwukierunkowe na plaskich tablicach next / prev, wiec push, decreaseKey i zdjecie
+ * elementu to O(1); pop przeglada puste kubelki, lacznie O(najwiekszy klucz + liczba operacji).
+ * Interfejs jak IndexedHeap.
+ */
+template <typename Key>
+class BucketQueue
+{
+    static_assert(std::is_integral_v<Key>, "BucketQueue requires integer keys");
+
+    static constexpr int NotInQueue = -1;
+    static constexpr int Removed = -2;
+
+    std::size_t bucketCount;
+    std::vector<int> heads;     // pierwszy element kubelka albo -1
+    std::vector<int> next;      // nastepny / poprzedni element w kubelku albo -1
+    std::vector<int> prev;
+    std::vector<Key> keys;
+    std::vector<int> buckets;   // element -> kubelek, NotInQueue albo Removed
+    std::size_t count = 0;
+    Key current = 0;            // najmniejszy mozliwy klucz w kolejce
+
+    void link(int item, Key key)
+    {
+        std::size_t bucket = static_cast<std::size_t>(key) % bucketCount;
+        keys[item] = key;
+        buckets[item] = static_cast<int>(bucket);
+        prev[item] = -1;
+        next[item] = heads[bucket];
+        if(heads[bucket] != -1)
+            prev[heads[bucket]] = item;
+        heads[bucket] = item;
+    }
+
+    void unlink(int item)
+    {
+        if(prev[item] != -1)
+            next[prev[item]] = next[item];
+        else
+            heads[buckets[item]] = next[item];
+        if(next[item] != -1)
+            prev[next[item]] = prev[item];
+    }
+
+  public:
+    BucketQueue(int capacity, Key maxStep)
+        : bucketCount(static_cast<std::size_t>(maxStep) + 1), heads(bucketCount, -1), next(capacity), prev(capacity),
+          keys(capacity), buckets(capacity, NotInQueue)
+    {
+    }
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    bool contains(int item) const { return buckets[item] >= 0; }
+    bool wasRemoved(int item) const { return buckets[item] == Removed; }
+
+    // Złożoność czasowa: O(1), pamięciowa: O(1)
+    void push(int item, Key key)
+    {
+        if(count == 0 || key < current)
+            current = key;
+        link(item, key);
+        ++count;
+    }
+
+    // Złożoność czasowa: O(1), pamięciowa: O(1)
+    void decreaseKey(int item, Key key)
+    {
+        unlink(item);
+        if(key < current)
+            current = key;
+        link(item, key);
+    }
+
+    // Kubelek biezacego klucza zawiera tylko elementy o tym kluczu, bo klucze nie przekraczaja min + maxStep.
+    // Złożoność czasowa: O(1 + liczba pominietych pustych kubelkow), pamięciowa: O(1)
+    int pop()
+    {
+        while(heads[static_cast<std::size_t>(current) % bucketCount] == -1)
+        {
+            ++current;
+        }
+        int item = heads[static_cast<std::size_t>(current) % bucketCount];
+        unlink(item);
+        buckets[item] = Removed;
+        --count;
+        return item;
+    }
+};
+
+/*
+ * Kopiec pozycyjny (radix heap) dla elementow 0..capacity-1 z nieujemnymi kluczami calkowitymi, monotoniczny:
+ * klucze wstawiane i zmniejszane nie moga byc mniejsze od ostatnio zdjetego (jak w algorytmie Dijkstry).
+ * Element o kluczu k lezy w kubelku 0, gdy k == last, a w przeciwnym razie w kubelku 1 + numer najstarszego
+ * bitu, ktorym k rozni sie od last (ostatnio zdjety klucz). pop oproznia najnizszy niepusty kubelek,
+ * przenoszac jego elementy do nizszych kubelkow, wiec kazdy element przechodzi co najwyzej log2(C) + 1 razy.
+ * Kubelki to tablice z pozycja elementu w kubelku, wiec decreaseKey przenosi element w O(1).
+ * Interfejs jak IndexedHeap.
+ */
+template <typename Key>
+class RadixHeap
+{
+    static_assert(std::is_integral_v<Key>, "RadixHeap requires integer keys");
+
+    static constexpr int BucketCount = 65;
+    static constexpr int NotInQueue = -1;
+    static constexpr int Removed = -2;
+
+    std::vector<int> bucketItems[BucketCount];
+    std::vector<Key> keys;
+    std::vector<int> buckets;   // element -> kubelek, NotInQueue albo Removed
+    std::vector<int> positions; // element -> pozycja w kubelku
+    std::size_t count = 0;
+    std::uint64_t last = 0;
+
+    int bucketOf(Key key) const
+    {
+        std::uint64_t value = static_cast<std::uint64_t>(key);
+        return value == last ? 0 : highestBit(value ^ last) + 1;
+    }
+
+    void place(int item, Key key)
+    {
+        int bucket = bucketOf(key);
+        keys[item] = key;
+        buckets[item] = bucket;
+        positions[item] = static_cast<int>(bucketItems[bucket].size());
+        bucketItems[bucket].push_back(item);
+    }
+
+    void remove(int item)
+    {
+        std::vector<int>& items = bucketItems[buckets[item]];
+        int moved = items.back();
+        items[positions[item]] = moved;
+        positions[moved] = positions[item];
+        items.pop_back();
+    }
+
+  public:
+    explicit RadixHeap(int capacity) : keys(capacity), buckets(capacity, NotInQueue), positions(capacity) {}
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    bool contains(int item) const { return buckets[item] >= 0; }
+    bool wasRemoved(int item) const { return buckets[item] == Removed; }
+
+    // Złożoność czasowa: O(1), pamięciowa: O(1) zamortyzowana
+    void push(int item, Key key)
+    {
+        place(item, key);
+        ++count;
+    }
+
+    // Złożoność czasowa: O(1), pamięciowa: O(1) zamortyzowana
+    void decreaseKey(int item, Key key)
+    {
+        remove(item);
+        place(item, key);
+    }
+
+    // Złożoność czasowa: O(log C) zamortyzowana, pamięciowa: O(1)
+    int pop()
+    {
+        if(bucketItems[0].empty())
+        {
+            int bucket = 1;
+            while(bucketItems[bucket].empty())
+            {
+                ++bucket;
+            }
+
+            std::vector<int> items;
+            items.swap(bucketItems[bucket]);
+            Key minimum = keys[items.front()];
+            for(int item : items)
+            {
+                if(keys[item] < minimum)
+                    minimum = keys[item];
+            }
+            last = static_cast<std::uint64_t>(minimum);
+            for(int item : items)
+            {
+                place(item, keys[item]);
+            }
+            items.clear();
+            items.swap(bucketItems[bucket]); // zachowuje zaalokowana pamiec kubelka
+        }
+
+        int item = bucketItems[0].back();
+        bucketItems[0].pop_back();
+        buckets[item] = Removed;
+        --count;
+        return item;
+    }
+};
+
+#endif /* BUCKET_QUEUES_HPP_ */
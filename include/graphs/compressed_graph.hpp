@@ -0,0 +1,211 @@
+#ifndef COMPRESSED_GRAPH_HPP_
+#define COMPRESSED_GRAPH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "graphs/read_only_graph.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+/*
+ * Skompresowana, niezmienna reprezentacja grafu skierowanego dla grafow, ktore nie mieszcza sie w CSR.
+ * Nastepniki kazdego wierzcholka sa posortowane rosnaco i zapisane jako roznice: pierwszy wzgledem indeksu
+ * wierzcholka (zigzag), kolejne jako odstepy od poprzedniego. Roznice sa kodowane jako group varint:
+ * grupy po 4 wartosci o dlugosci 1..4 bajtow z jednym bajtem znacznika dlugosci, co dekoduje sie bez
+ * lancucha zaleznosci bajt po bajcie (jak w klasycznym varint) i bez skokow zaleznych od danych.
+ * Wagi leza w osobnej tablicy upakowanej na bajty (PackedWeights), a identyfikatory, budowa i iteracja
+ * sa wspolne z SuccinctGraph (BasicReadOnlyGraph). Indeks odwrotny trzyma dla kazdego wierzcholka
+ * rosnace identyfikatory krawedzi wchodzacych zakodowane tak samo (odstepy, group varint); poczatek takiej
+ * krawedzi to wierzcholek, do ktorego zakresu nalezy jej identyfikator (wyszukiwanie binarne).
+ */
+template <typename W>
+class BasicCompressedGraph : public BasicReadOnlyGraph<BasicCompressedGraph<W>, W>
+{
+    using Base = BasicReadOnlyGraph<BasicCompressedGraph<W>, W>;
+    friend Base;
+
+    // Poczatek zakodowanej listy wierzcholka i pierwszy identyfikator jego krawedzi, obok siebie, zeby
+    // otwarcie listy losowego wierzcholka kosztowalo jeden brak w pamieci podrecznej jak w CSR.
+    // Oba pola w jednym slowie 64-bitowym (33 bity bajtu, 31 bitow krawedzi) zamiast 16 bajtow z wyrownaniem.
+    class ListOffset
+    {
+        std::uint64_t word = 0;
+
+      public:
+        static constexpr std::size_t MaxByte = (std::size_t{1} << 33) - 1;
+
+        ListOffset() = default;
+        ListOffset(std::size_t byte, int edge) : word(std::uint64_t{byte} << 31 | static_cast<std::uint32_t>(edge)) {}
+
+        std::size_t byte() const { return static_cast<std::size_t>(word >> 31); }
+        int edge() const { return static_cast<int>(word & 0x7FFFFFFF); }
+    };
+    std::vector<ListOffset> offsets; // n + 1
+    std::vector<std::uint8_t> adjacency;
+    std::vector<ListOffset> inOffsets; // n + 1; edge to pozycja listy w porzadku krawedzi wchodzacych
+    std::vector<std::uint8_t> inAdjacency;
+
+    static constexpr const char* typeName = "CompressedGraph";
+    static constexpr const char* printTitle = "SKOMPRESOWANA";
+
+    static std::unique_ptr<BasicCompressedGraph> build(std::vector<int> ids, const std::vector<int>& sources,
+                                                       const std::vector<int>& targets, const std::vector<W>& weights);
+
+    int sourceIndex(int e) const;
+    int targetIndex(int e) const;
+
+    // Polozenie wartosci grupy group varint dla kazdego bajtu znacznika
+    struct GroupLayout
+    {
+        std::uint8_t offsets[4];
+        std::uint8_t size;
+        std::uint32_t masks[4];
+    };
+
+    static constexpr std::array<GroupLayout, 256> makeGroupLayouts()
+    {
+        std::array<GroupLayout, 256> layouts{};
+        for(int tag = 0; tag < 256; ++tag)
+        {
+            std::uint8_t offset = 0;
+            for(int i = 0; i < 4; ++i)
+            {
+                int length = ((tag >> (2 * i)) & 3) + 1;
+                layouts[tag].offsets[i] = offset;
+                layouts[tag].masks[i] = 0xffffffffu >> (32 - 8 * length);
+                offset = static_cast<std::uint8_t>(offset + length);
+            }
+            layouts[tag].size = offset;
+        }
+        return layouts;
+    }
+
+    static constexpr std::array<GroupLayout, 256> groupLayouts = makeGroupLayouts();
+
+  public:
+    // Dekoduje nastepniki jednego wierzcholka w kolejnosci rosnacej:
+    // for(auto cursor = graph.neighbors(u); cursor.next();) { cursor.target(); cursor.edge(); }
+    class NeighborCursor
+    {
+        const std::uint8_t* pos; // znacznik nastepnej grupy
+        std::uint32_t values[4];
+        int slot = 4;
+        int current;
+        int edgeId;
+        int edgeEnd;
+
+        // Grupa: bajt znacznika (2 bity na dlugosc 1..4 bajtow kazdej wartosci) i 4 wartosci. Polozenia
+        // i maski wartosci sa brane z tablicy dla znacznika, wiec 4 odczyty nie zaleza od siebie
+        // (tablica ma zapas 8 bajtow za koncem).
+        void readGroup()
+        {
+            const GroupLayout& layout = groupLayouts[*pos];
+            const std::uint8_t* data = pos + 1;
+            for(int i = 0; i < 4; ++i)
+            {
+                std::uint32_t word;
+                std::memcpy(&word, data + layout.offsets[i], sizeof(word));
+                values[i] = word & layout.masks[i];
+            }
+            pos = data + layout.size;
+            slot = 0;
+        }
+
+      public:
+        NeighborCursor(const std::uint8_t* pos, int index, int firstEdge, int edgeEnd)
+            : pos(pos), current(index), edgeId(firstEdge - 1), edgeEnd(edgeEnd)
+        {
+            // Pierwsza wartosc to roznica (zigzag) wzgledem indeksu wierzcholka, kolejne to odstepy
+            if(firstEdge != edgeEnd)
+            {
+                readGroup();
+                current += static_cast<int>((values[0] >> 1) ^ (0u - (values[0] & 1)));
+                values[0] = 0;
+            }
+        }
+
+        // Przechodzi do nastepnego sasiada; false, gdy sasiadow juz nie ma
+        bool next()
+        {
+            if(++edgeId == edgeEnd)
+                return false;
+            if(slot == 4)
+                readGroup();
+            current += static_cast<int>(values[slot++]);
+            return true;
+        }
+
+        int target() const { return current; } // indeks nastepnika
+        int edge() const { return edgeId; }
+    };
+
+    // Dekoduje identyfikatory krawedzi wchodzacych jednego wierzcholka w kolejnosci rosnacej:
+    // for(auto cursor = graph.inEdgeIds(u); cursor.next();) { cursor.edge(); }
+    class InEdgeCursor
+    {
+        NeighborCursor ids; // "nastepniki" liczone od 0 to identyfikatory krawedzi
+
+      public:
+        explicit InEdgeCursor(NeighborCursor ids) : ids(ids) {}
+
+        bool next() { return ids.next(); }
+        int edge() const { return ids.target(); }
+    };
+
+    // Iteration methods
+    std::vector<int> inEdges(int v) const override;
+
+    // Access methods
+    bool areAdjacent(int v1, int v2) const override;
+
+    // Non-allocating access methods
+    void forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const override;
+
+    // Dostep po gestych indeksach wierzcholkow
+    int firstEdge(int index) const { return offsets[index].edge(); }
+    int outDegree(int index) const { return offsets[index + 1].edge() - offsets[index].edge(); }
+
+    NeighborCursor neighbors(int index) const
+    {
+        return {adjacency.data() + offsets[index].byte(), index, offsets[index].edge(), offsets[index + 1].edge()};
+    }
+
+    InEdgeCursor inEdgeIds(int index) const
+    {
+        return InEdgeCursor({inAdjacency.data() + inOffsets[index].byte(), 0, inOffsets[index].edge(),
+                             inOffsets[index + 1].edge()});
+    }
+
+    // Sciaga do pamieci podrecznej poczatek listy nastepnikow wierzcholka index. Wolane dla wierzcholka
+    // kilka pozycji dalej w kolejce BFS lub dla szczytu kopca Dijkstry, naklada braki w pamieci podrecznej
+    // kolejnych list na siebie zamiast czekac na kazdy po kolei.
+    void prefetch(int index) const
+    {
+        const char* address = reinterpret_cast<const char*>(adjacency.data() + offsets[index].byte());
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(address, _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(address);
+#else
+        (void)address;
+#endif
+    }
+
+    // Pamiec zajmowana przez tablice grafu w bajtach
+    std::size_t memoryUsage() const;
+};
+
+#define GRAPHS_DECLARE_COMPRESSED_GRAPH(W)                                                                             \
+    extern template class BasicReadOnlyGraph<BasicCompressedGraph<W>, W>;                                              \
+    extern template class BasicCompressedGraph<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_COMPRESSED_GRAPH)
+#undef GRAPHS_DECLARE_COMPRESSED_GRAPH
+
+using CompressedGraph = BasicCompressedGraph<int>;
+
+#endif /* COMPRESSED_GRAPH_HPP_ */
@@ -0,0 +1,43 @@
+#ifndef CSR_BINARY_HPP_
+#define CSR_BINARY_HPP_
+
+#include <filesystem>
+#include <memory>
+#include "graphs/csr_graph.hpp"
+#include "graphs/graph.hpp"
+
+/*
+ * Binarny format grafu CSR (wersja 1), w natywnej kolejnosci bajtow:
+ *   naglowek 64 B: magic "PIAACSR", wersja, znacznik kolejnosci bajtow, flagi (bit 0 - graf nieskierowany),
+ *                  kod typu wagi, V, E, suma kontrolna danych, suma kontrolna naglowka;
+ *   dane: vertexIds (V), outOffsets (V + 1), outTargets (E), outEdgeIds (E), inOffsets (V + 1), inSlots (E),
+ *         edgeSources (E), edgeSlots (E), outWeights (E wag typu W); kazda tablica wyrownana do 8 bajtow.
+ * Sumy kontrolne to FNV-1a liczone po slowach 64-bitowych.
+ * Tablice leza w pliku dokladnie tak jak w BasicCsrGraph, wiec loadCsrBinary odwzorowuje plik w pamieci
+ * i buduje graf na widokach do niego (fromArrays) bez parsowania i kopiowania.
+ */
+
+// Zapisuje graf do pliku; rzuca std::runtime_error przy bledzie zapisu
+template <typename W>
+void saveCsrBinary(const BasicCsrGraph<W>& graph, const std::filesystem::path& path);
+
+// Wczytuje graf z pliku bez kopiowania danych; graf utrzymuje odwzorowanie pliku.
+// verifyChecksum = false pomija sume kontrolna danych; indeksy i tak sa sprawdzane przez fromArrays (O(V + E)).
+// Rzuca std::runtime_error dla pliku w innym formacie, wersji, typie wagi lub uszkodzonego.
+template <typename W>
+std::unique_ptr<BasicCsrGraph<W>> loadCsrBinary(const std::filesystem::path& path, bool verifyChecksum = true);
+
+// Konwertuje plik tekstowy ("V E / v1 v2 w") do formatu binarnego
+template <typename W>
+void convertTextToCsrBinary(const std::filesystem::path& textPath, const std::filesystem::path& binaryPath,
+                            EdgeDirection direction = EdgeDirection::Directed);
+
+#define GRAPHS_DECLARE_CSR_BINARY(W)                                                                                   \
+    extern template void saveCsrBinary(const BasicCsrGraph<W>&, const std::filesystem::path&);                         \
+    extern template std::unique_ptr<BasicCsrGraph<W>> loadCsrBinary(const std::filesystem::path&, bool);              \
+    extern template void convertTextToCsrBinary<W>(const std::filesystem::path&, const std::filesystem::path&,        \
+                                                   EdgeDirection);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_CSR_BINARY)
+#undef GRAPHS_DECLARE_CSR_BINARY
+
+#endif /* CSR_BINARY_HPP_ */
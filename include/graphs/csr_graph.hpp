@@ -0,0 +1,175 @@
+#ifndef CSR_GRAPH_HPP_
+#define CSR_GRAPH_HPP_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "graphs/edge_list.hpp"
+#include "graphs/graph.hpp"
+#include "graphs/span.hpp"
+#include "graphs/weight_traits.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
+/*
+ * Niezmienna reprezentacja grafu w formacie CSR (compressed sparse row).
+ * Wierzcholki sa numerowane gesto (indeksy 0..n-1), a krawedzie wychodzace
+ * z wierzcholka zajmuja ciagly zakres [outBegin(u), outEnd(u)) w tablicach
+ * outTargets / outWeights. Identyfikatory wierzcholkow zrodlowego grafu sa
+ * zachowane, krawedzie dostaja identyfikatory 0..m-1 w kolejnosci wstawienia.
+ * Graf nieskierowany przechowuje kazda krawedz raz; metody grafu (outEdges, forEachOutNeighbor, ...)
+ * pokazuja ja wtedy z obu koncow, a algorytmy pracujace na slotach przegladaja zakresy out i in.
+ * Tablice CSR sa widokami (Span) na pamiec trzymana przez owner: wlasne wektory grafu
+ * albo plik odwzorowany w pamieci (loadCsrBinary), wiec graf wczytany z pliku nie kopiuje danych.
+ */
+template <typename W>
+class BasicCsrGraph : public BasicGraph<W>
+{
+  public:
+    // Komplet tablic CSR dla n wierzcholkow i m krawedzi
+    struct Arrays
+    {
+        Span<const int> vertexIds;   // indeks -> identyfikator wierzcholka, n
+        Span<const int> outOffsets;  // n + 1
+        Span<const int> outTargets;  // indeks wierzcholka koncowego, m
+        Span<const W> outWeights;    // m
+        Span<const int> outEdgeIds;  // identyfikator krawedzi w danym slocie, m
+        Span<const int> inOffsets;   // n + 1
+        Span<const int> inSlots;     // sloty CSR krawedzi wchodzacych, m
+        Span<const int> edgeSources; // identyfikator krawedzi -> indeks poczatku, m
+        Span<const int> edgeSlots;   // identyfikator krawedzi -> slot CSR, m
+    };
+
+  private:
+    int vertexCount = 0;
+    int edgeCount = 0;
+    bool directed = true;
+
+    std::shared_ptr<const void> owner;             // trzyma pamiec, na ktora wskazuja widoki
+    std::unordered_map<int, int> vertexIndices;    // identyfikator -> indeks (puste, gdy identycznosc)
+
+    Span<const int> vertexIds;
+    Span<const int> outOffsets;
+    Span<const int> outTargets;
+    Span<const W> outWeights;
+    Span<const int> outEdgeIds;
+    Span<const int> inOffsets;
+    Span<const int> inSlots;
+    Span<const int> edgeSources;
+    Span<const int> edgeSlots;
+
+    static std::unique_ptr<BasicCsrGraph> build(std::vector<int> ids, const std::vector<int>& sources,
+                                                const std::vector<int>& targets, const std::vector<W>& weights,
+                                                int threadCount = 1);
+    // fromArrays bez sprawdzania tablic - dla tablic zbudowanych przez build
+    static std::unique_ptr<BasicCsrGraph> wrapArrays(const Arrays& arrays, std::shared_ptr<const void> owner,
+                                                     bool directed);
+
+    int edgeSlot(int e) const;
+
+  public:
+    // Update methods
+    int insertVertex(int val = 0) override;
+    int insertEdge(int v1, int v2, W weight) override;
+    void removeVertex(int v) override;
+    void removeEdge(int e) override;
+    int insertVertices(int n) override;
+    int insertEdges(Span<const typename BasicGraph<W>::EdgeInput> input) override;
+
+    // Iteration methods
+    std::vector<int> showVertices() const override;
+    std::vector<int> showEdges() const override;
+    std::vector<int> incidentEdges(int v) const override;
+    std::vector<int> outEdges(int v) const override;
+    std::vector<int> inEdges(int v) const override;
+
+    // Access methods
+    std::vector<int> endVertices(int edge) const override;
+    bool areAdjacent(int v1, int v2) const override;
+    int opposite(int v, int e) const override;
+    W edgeWeight(int e) const override;
+    void replaceVertices(int v, int val) override;
+    void replaceEdges(int e, W weight) override;
+    bool isDirected() const override { return directed; }
+
+    // Non-allocating access methods
+    int numVertices() const override { return vertexCount; }
+    int numEdges() const override { return edgeCount; }
+    std::pair<int, int> endpoints(int e) const override;
+    void forEachVertex(FunctionRef<void(int v)> visit) const override;
+    void forEachEdge(typename BasicGraph<W>::EdgeVisitor visit) const override;
+    void forEachOutNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const override;
+    void forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const override;
+
+    void printGraph() const override;
+
+    // Dostep do struktury CSR po gestych indeksach wierzcholkow
+    int indexOf(int v) const;
+    int vertexAt(int index) const { return vertexIds[index]; }
+
+    int outBegin(int index) const { return outOffsets[index]; }
+    int outEnd(int index) const { return outOffsets[index + 1]; }
+    int inBegin(int index) const { return inOffsets[index]; }
+    int inEnd(int index) const { return inOffsets[index + 1]; }
+
+    int target(int slot) const { return outTargets[slot]; }
+    W weight(int slot) const { return outWeights[slot]; }
+    int edgeAt(int slot) const { return outEdgeIds[slot]; }
+    int inSlot(int i) const { return inSlots[i]; }
+    int source(int slot) const { return edgeSources[outEdgeIds[slot]]; }
+
+    // Widoki na nastepnikow (indeksy) i wagi krawedzi wychodzacych z wierzcholka o indeksie index
+    Span<const int> neighbors(int index) const { return {outTargets.data() + outBegin(index), outDegree(index)}; }
+    Span<const W> neighborWeights(int index) const { return {outWeights.data() + outBegin(index), outDegree(index)}; }
+    std::size_t outDegree(int index) const { return static_cast<std::size_t>(outEnd(index) - outBegin(index)); }
+
+    // Sciaga do pamieci podrecznej poczatek nastepnikow wierzcholka index (jak CompressedGraph::prefetch).
+    void prefetch(int index) const
+    {
+        const char* address = reinterpret_cast<const char*>(outTargets.data() + outBegin(index));
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(address, _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(address);
+#else
+        (void)address;
+#endif
+    }
+
+    // Pamiec zajmowana przez tablice grafu w bajtach (razem z tablicami odwzorowanymi z pliku)
+    std::size_t memoryUsage() const;
+
+    Arrays arrays() const;
+
+    // Graf nad gotowymi tablicami bez kopiowania; owner musi utrzymywac ich pamiec.
+    // Sprawdza rozmiary tablic, monotonicznosc przesuniec, zakresy wszystkich indeksow i zgodnosc slotow
+    // z identyfikatorami krawedzi (O(V + E)), rzuca std::invalid_argument.
+    static std::unique_ptr<BasicCsrGraph> fromArrays(const Arrays& arrays, std::shared_ptr<const void> owner,
+                                                     bool directed);
+    static std::unique_ptr<BasicCsrGraph> fromGraph(const BasicGraph<W>& graph);
+    static std::unique_ptr<BasicGraph<W>> createGraph(std::istream& is,
+                                                      EdgeDirection direction = EdgeDirection::Directed);
+    // threadCount > 1 (0 - liczba rdzeni) buduje tablice rownoleglym sortowaniem przez zliczanie,
+    // z tym samym wynikiem co wersja jednowatkowa
+    static std::unique_ptr<BasicGraph<W>> createGraph(const BasicEdgeList<W>& edgeList,
+                                                      EdgeDirection direction = EdgeDirection::Directed,
+                                                      int threadCount = 1);
+};
+
+// Zwraca graph jako graf CSR: ten sam obiekt, jesli juz jest w formacie CSR,
+// w przeciwnym razie kopie zbudowana w storage. Grafy CompressedGraph i SuccinctGraph sa odrzucane
+// (std::invalid_argument) - kopia CSR zajelaby kilka razy wiecej pamieci niz one same.
+template <typename W>
+const BasicCsrGraph<W>& asCsr(const BasicGraph<W>& graph, std::unique_ptr<BasicCsrGraph<W>>& storage);
+
+#define GRAPHS_DECLARE_CSR_GRAPH(W)                                                                                    \
+    extern template class BasicCsrGraph<W>;                                                                            \
+    extern template const BasicCsrGraph<W>& asCsr(const BasicGraph<W>&, std::unique_ptr<BasicCsrGraph<W>>&);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_CSR_GRAPH)
+#undef GRAPHS_DECLARE_CSR_GRAPH
+
+using CsrGraph = BasicCsrGraph<int>;
+
+#endif /* CSR_GRAPH_HPP_ */
@@ -0,0 +1,65 @@
+#ifndef EDGE_LIST_HPP_
+#define EDGE_LIST_HPP_
+
+#include <filesystem>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "graphs/graph.hpp"
+#include "graphs/weight_traits.hpp"
+
+// Graf wczytany z pliku jako plaska lista krawedzi, z ktorej createGraph(edgeList)
+// buduje dowolna reprezentacje jednym hurtowym wstawieniem
+template <typename W>
+struct BasicEdgeList
+{
+    int vertexCount = 0;
+    std::vector<typename BasicGraph<W>::EdgeInput> edges;
+    std::optional<int> source; // wierzcholek startowy z ostatniej linii (pliki sp_data)
+};
+
+// Blad formatu pliku wejsciowego z numerem linii (liczonym od 1)
+class ParseError : public std::runtime_error
+{
+    int lineNumber;
+
+  public:
+    ParseError(int line, const std::string& message)
+        : std::runtime_error("line " + std::to_string(line) + ": " + message), lineNumber(line)
+    {
+    }
+
+    int line() const { return lineNumber; }
+};
+
+// Parsuje format "V E", E linii "v1 v2 waga" i opcjonalny wierzcholek startowy przez std::from_chars
+// (bez strumieni i locale). Sprawdza zakres wag i numerow wierzcholkow, bledy zglasza jako ParseError.
+template <typename W>
+BasicEdgeList<W> parseEdgeList(const char* begin, const char* end);
+
+// parseEdgeList na pliku odwzorowanym w pamieci (MappedFile)
+template <typename W>
+BasicEdgeList<W> loadEdgeList(const std::filesystem::path& path);
+
+// Wielowatkowa wersja parseEdgeList dla duzych plikow: dane po naglowku sa dzielone na fragmenty
+// na granicach linii, parsowane rownolegle do buforow watkow i scalane w kolejnosci pliku, wiec wynik
+// (i kolejnosc krawedzi) jest taki sam jak z parseEdgeList. Wymaga jednej krawedzi na linie,
+// wierzcholek startowy moze byc tylko w ostatniej niepustej linii. threadCount = 0 - liczba rdzeni.
+template <typename W>
+BasicEdgeList<W> parseEdgeListParallel(const char* begin, const char* end, int threadCount = 0);
+
+template <typename W>
+BasicEdgeList<W> loadEdgeListParallel(const std::filesystem::path& path, int threadCount = 0);
+
+#define GRAPHS_DECLARE_EDGE_LIST(W)                                                                                    \
+    extern template BasicEdgeList<W> parseEdgeList(const char*, const char*);                                         \
+    extern template BasicEdgeList<W> loadEdgeList(const std::filesystem::path&);                                      \
+    extern template BasicEdgeList<W> parseEdgeListParallel(const char*, const char*, int);                            \
+    extern template BasicEdgeList<W> loadEdgeListParallel(const std::filesystem::path&, int);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_EDGE_LIST)
+#undef GRAPHS_DECLARE_EDGE_LIST
+
+using EdgeList = BasicEdgeList<int>;
+
+#endif /* EDGE_LIST_HPP_ */
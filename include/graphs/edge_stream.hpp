@@ -0,0 +1,98 @@
+#ifndef EDGE_STREAM_HPP_
+#define EDGE_STREAM_HPP_
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <istream>
+#include "graphs/graph.hpp"
+#include "graphs/mapped_file.hpp"
+#include "graphs/span.hpp"
+#include "graphs/text_cursor.hpp"
+#include "graphs/weight_traits.hpp"
+
+/*
+ * Zrodlo krawedzi czytane porcjami, bez budowania calego grafu w pamieci.
+ * Wierzcholki sa numerowane 0..vertexCount()-1, read wypelnia bufor kolejnymi krawedziami
+ * i zwraca ich liczbe; 0 oznacza koniec strumienia. Algorytmy strumieniowe (kruskal,
+ * connectedComponents) trzymaja wtedy tylko O(V) stanu i jeden bufor krawedzi.
+ */
+template <typename W>
+class BasicEdgeStream
+{
+  public:
+    using EdgeInput = typename BasicGraph<W>::EdgeInput;
+
+    virtual ~BasicEdgeStream() = default;
+
+    virtual int vertexCount() const = 0;
+    virtual std::size_t read(Span<EdgeInput> buffer) = 0;
+};
+
+// Krawedzie z formatu "V E" + E linii "v1 v2 waga" czytane ze strumienia (naglowek w konstruktorze).
+// Niepoprawne dane zglasza jako std::invalid_argument.
+template <typename W>
+class BasicIstreamEdgeStream : public BasicEdgeStream<W>
+{
+    std::istream& is;
+    int vertices = 0;
+    int remaining = 0;
+
+  public:
+    explicit BasicIstreamEdgeStream(std::istream& is);
+
+    int vertexCount() const override { return vertices; }
+    std::size_t read(Span<typename BasicEdgeStream<W>::EdgeInput> buffer) override;
+};
+
+// Ten sam format z pliku odwzorowanego w pamieci, parsowany przez std::from_chars jak loadEdgeList.
+// Strony pliku sa czytane sekwencyjnie i nie sa kopiowane, wiec system moze je zwalniac w trakcie.
+// Bledy formatu zglasza jako ParseError; wierzcholek startowy po krawedziach jest pomijany.
+template <typename W>
+class BasicMappedEdgeStream : public BasicEdgeStream<W>
+{
+    MappedFile file;
+    TextCursor cursor;
+    int vertices = 0;
+    int remaining = 0;
+
+  public:
+    explicit BasicMappedEdgeStream(const std::filesystem::path& path);
+
+    int vertexCount() const override { return vertices; }
+    std::size_t read(Span<typename BasicEdgeStream<W>::EdgeInput> buffer) override;
+};
+
+// Krawedzie wytwarzane przez funkcje next: next(edge) wypelnia kolejna krawedz
+// albo zwraca false, gdy krawedzi juz nie ma.
+template <typename W>
+class BasicGeneratorEdgeStream : public BasicEdgeStream<W>
+{
+  public:
+    using Generator = std::function<bool(typename BasicEdgeStream<W>::EdgeInput& edge)>;
+
+  private:
+    int vertices;
+    Generator next;
+    bool finished = false;
+
+  public:
+    BasicGeneratorEdgeStream(int vertexCount, Generator next);
+
+    int vertexCount() const override { return vertices; }
+    std::size_t read(Span<typename BasicEdgeStream<W>::EdgeInput> buffer) override;
+};
+
+#define GRAPHS_DECLARE_EDGE_STREAMS(W)                                                                                 \
+    extern template class BasicIstreamEdgeStream<W>;                                                                   \
+    extern template class BasicMappedEdgeStream<W>;                                                                    \
+    extern template class BasicGeneratorEdgeStream<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_EDGE_STREAMS)
+#undef GRAPHS_DECLARE_EDGE_STREAMS
+
+using EdgeStream = BasicEdgeStream<int>;
+using IstreamEdgeStream = BasicIstreamEdgeStream<int>;
+using MappedEdgeStream = BasicMappedEdgeStream<int>;
+using GeneratorEdgeStream = BasicGeneratorEdgeStream<int>;
+
+#endif /* EDGE_STREAM_HPP_ */
@@ -0,0 +1,123 @@
+#ifndef ELIAS_FANO_HPP_
+#define ELIAS_FANO_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "graphs/bit_ops.hpp"
+
+/*
+ * Wektor bitowy z indeksami rank/select.
+ * rank1 - liczby jedynek przed kazdym blokiem 512 bitow (8 slow), potem popcount slow w bloku;
+ * select1/select0 - pozycja co 256. jedynki (zera), potem przegladanie slow i wybor bitu w slowie.
+ * Indeksy zajmuja ok. 1/8 + 1/256 rozmiaru wektora.
+ */
+class BitVector
+{
+    std::vector<std::uint64_t> words;
+    std::size_t bitCount = 0;
+    std::vector<std::uint64_t> blockRanks;  // jedynki przed blokiem, liczba blokow + 1
+    std::vector<std::uint64_t> oneSamples;  // pozycja jedynek o numerach 0, 256, 512, ...
+    std::vector<std::uint64_t> zeroSamples; // pozycja zer o numerach 0, 256, 512, ...
+
+  public:
+    static constexpr std::size_t BlockWords = 8;
+    static constexpr std::size_t SampleRate = 256;
+
+    BitVector() = default;
+    // words zawiera bitCount bitow (bit i to bit i % 64 slowa i / 64), bity za bitCount musza byc zerami
+    BitVector(std::vector<std::uint64_t> words, std::size_t bitCount);
+
+    std::size_t size() const { return bitCount; }
+    bool operator[](std::size_t i) const { return (words[i / 64] >> (i % 64)) & 1; }
+    std::uint64_t word(std::size_t i) const { return words[i]; }
+
+    // Liczba jedynek na pozycjach [0, i)
+    std::size_t rank1(std::size_t i) const;
+    std::size_t rank0(std::size_t i) const { return i - rank1(i); }
+
+    // Pozycja k-tej (od 0) jedynki / zera; k musi byc mniejsze niz ich liczba
+    std::size_t select1(std::size_t k) const;
+    std::size_t select0(std::size_t k) const;
+
+    std::size_t memoryUsage() const;
+};
+
+/*
+ * Niemalejacy ciag n liczb z zakresu [0, universe) w kodowaniu Eliasa-Fano: l = floor(log2(universe / n))
+ * mlodszych bitow kazdej wartosci zapisanych wprost, starsze bity unarnie w wektorze bitowym (jedynka
+ * wartosci i na pozycji (v >> l) + i). Zajmuje n (2 + l) bitow, blisko dolnego ograniczenia
+ * log2(C(universe, n)); dostep do i-tej wartosci przez select1, wyszukiwanie nastepnika przez select0.
+ */
+class EliasFano
+{
+    std::size_t count = 0;
+    std::uint64_t universe = 0;
+    int lowBits = 0;
+    std::vector<std::uint64_t> lows; // z zapasowym slowem na koncu
+    BitVector highs;
+
+    std::uint64_t low(std::size_t i) const
+    {
+        if(lowBits == 0)
+            return 0;
+        std::size_t bit = i * lowBits;
+        std::size_t index = bit / 64;
+        int shift = static_cast<int>(bit % 64);
+        std::uint64_t value = lows[index] >> shift;
+        if(shift + lowBits > 64)
+            value |= lows[index + 1] << (64 - shift);
+        return value & (~0ULL >> (64 - lowBits));
+    }
+
+  public:
+    // Dekoduje kolejne wartosci od zadanego indeksu: for(auto c = ef.cursor(i); ...;) c.next();
+    class Cursor
+    {
+        const EliasFano* sequence;
+        std::size_t index;
+        std::size_t wordIndex;
+        std::uint64_t buffer; // nieodczytane bity biezacego slowa wektora starszych bitow
+
+      public:
+        Cursor(const EliasFano& sequence, std::size_t index);
+
+        // Nastepna wartosc; nie wolno czytac za koncem ciagu
+        std::uint64_t next()
+        {
+            while(buffer == 0)
+            {
+                buffer = sequence->highs.word(++wordIndex);
+            }
+            std::size_t position = wordIndex * 64 + countTrailingZeros(buffer);
+            buffer &= buffer - 1;
+            std::uint64_t value = (static_cast<std::uint64_t>(position - index) << sequence->lowBits) |
+                                  sequence->low(index);
+            ++index;
+            return value;
+        }
+
+        std::size_t position() const { return index; }
+    };
+
+    EliasFano() = default;
+    // values niemalejace, wszystkie mniejsze od universe
+    EliasFano(const std::vector<std::uint64_t>& values, std::uint64_t universe);
+
+    std::size_t size() const { return count; }
+
+    // Złożoność czasowa: O(1) oczekiwana
+    std::uint64_t operator[](std::size_t i) const
+    {
+        return (static_cast<std::uint64_t>(highs.select1(i) - i) << lowBits) | low(i);
+    }
+
+    // Indeks pierwszej wartosci >= x albo size(), gdy takiej nie ma
+    std::size_t lowerBound(std::uint64_t x) const;
+
+    Cursor cursor(std::size_t i) const { return {*this, i}; }
+
+    std::size_t memoryUsage() const;
+};
+
+#endif /* ELIAS_FANO_HPP_ */
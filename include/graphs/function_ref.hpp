@@ -0,0 +1,35 @@
+#ifndef FUNCTION_REF_HPP_
+#define FUNCTION_REF_HPP_
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+template <typename Signature>
+class FunctionRef;
+
+/*
+ * Nieposiadajace odwolanie do obiektu wywolywalnego (wskaznik na obiekt + funkcja posredniczaca).
+ * W przeciwienstwie do std::function nigdy nie alokuje, wiec nadaje sie na parametr
+ * metod wirtualnych wywolywanych w petlach algorytmow. Obiekt musi zyc dluzej niz FunctionRef.
+ */
+template <typename R, typename... Args>
+class FunctionRef<R(Args...)>
+{
+    void* object;
+    R (*invoke)(void*, Args...);
+
+  public:
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, FunctionRef>>>
+    FunctionRef(F&& f) noexcept
+        : object(const_cast<void*>(static_cast<const void*>(std::addressof(f))))
+        , invoke([](void* obj, Args... args) -> R {
+            return (*static_cast<std::remove_reference_t<F>*>(obj))(std::forward<Args>(args)...);
+        })
+    {
+    }
+
+    R operator()(Args... args) const { return invoke(object, std::forward<Args>(args)...); }
+};
+
+#endif /* FUNCTION_REF_HPP_ */
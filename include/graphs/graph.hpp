@@ -2,34 +2,126 @@
 #define GRAPH_HPP_
 
 #include <iostream>
+#include <cstdint>
 #include <memory>
+#include <unordered_map>
+#include <utility>
 #include <vector>
+#include "graphs/function_ref.hpp"
+#include "graphs/span.hpp"
 
-class Graph
+// Sposob przechowywania krawedzi: Undirected zapisuje krawedz nieskierowana raz
+// i udostepnia ja z obu koncow (jako wychodzaca i wchodzaca)
+enum class EdgeDirection
+{
+    Directed,
+    Undirected
+};
+
+// Interfejs grafu z wagami krawedzi typu W
+template <typename W>
+class BasicGraph
 {
   public:
+    using weight_type = W;
+
+    // Krawedz do wstawienia hurtowego przez insertEdges
+    struct EdgeInput
+    {
+        int v1, v2;
+        W weight;
+    };
 
-    virtual ~Graph() = default;
+    virtual ~BasicGraph() = default;
 
     // Update methods
-    virtual int insertVertex(int val) = 0;
-    virtual int insertEdge(int v1, int v2, int weight) = 0;
+    virtual int insertVertex(int val = 0) = 0;
+    virtual int insertEdge(int v1, int v2, W weight) = 0;
     virtual void removeVertex(int v) = 0;
     virtual void removeEdge(int e) = 0;
 
+    // Bulk update methods
+    // Wstawiaja n wierzcholkow / wszystkie krawedzie z input po jednej rezerwacji pamieci
+    // i zwracaja identyfikator pierwszego nowego elementu; kolejne maja identyfikatory first + i.
+    // insertEdges sprawdza wszystkie konce przed modyfikacja grafu, wiec przy bledzie graf jest niezmieniony.
+    virtual int insertVertices(int n) = 0;
+    virtual int insertEdges(Span<const EdgeInput> input) = 0;
+
     // Iteration methods
     virtual std::vector<int> showVertices() const = 0;
     virtual std::vector<int> showEdges() const = 0;
     virtual std::vector<int> incidentEdges(int v) const = 0;
+    virtual std::vector<int> outEdges(int v) const = 0;
+    virtual std::vector<int> inEdges(int v) const = 0;
 
     // Access methods
     virtual std::vector<int> endVertices(int edge) const = 0;
     virtual bool areAdjacent(int v1, int v2) const = 0;
     virtual int opposite(int v, int e) const = 0;
+    virtual W edgeWeight(int e) const = 0;
     virtual void replaceVertices(int v, int val) = 0;
-    virtual void replaceEdges(int e, int weight) = 0;
+    virtual void replaceEdges(int e, W weight) = 0;
+
+    // Non-allocating access methods
+    // visit(sasiad, identyfikator krawedzi, waga) dla kazdej krawedzi wychodzacej z / wchodzacej do v
+    using NeighborVisitor = FunctionRef<void(int neighbor, int edge, W weight)>;
+    // visit(identyfikator krawedzi, poczatek, koniec, waga)
+    using EdgeVisitor = FunctionRef<void(int edge, int v1, int v2, W weight)>;
+
+    virtual int numVertices() const = 0;
+    virtual int numEdges() const = 0;
+    virtual std::pair<int, int> endpoints(int e) const = 0;
+    virtual void forEachVertex(FunctionRef<void(int v)> visit) const = 0;
+    virtual void forEachEdge(EdgeVisitor visit) const = 0;
+    virtual void forEachOutNeighbor(int v, NeighborVisitor visit) const = 0;
+    virtual void forEachInNeighbor(int v, NeighborVisitor visit) const = 0;
+
+    virtual bool isDirected() const = 0;
 
     virtual void printGraph() const = 0;
 };
 
+// Usuwa z input krawedzie (v2, v1, w), dla ktorych wczesniej wystapila para (v1, v2, w),
+// czyli drugi zapis tej samej krawedzi nieskierowanej. Kazde wystapienie (v1, v2, w) sparowane
+// jest z co najwyzej jednym odwrotnym, petle wlasne zostaja bez zmian, kolejnosc jest zachowana.
+// Złożoność czasowa: O(E) oczekiwana, pamięciowa: O(E)
+template <typename EdgeInput>
+void collapseReciprocalEdges(std::vector<EdgeInput>& input)
+{
+    auto key = [](int v1, int v2) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(v1)) << 32) | static_cast<std::uint32_t>(v2);
+    };
+
+    std::unordered_multimap<std::uint64_t, std::size_t> unmatched; // (v1, v2) -> pozycja w input
+    unmatched.reserve(input.size());
+    std::size_t kept = 0;
+    for(std::size_t i = 0; i < input.size(); ++i)
+    {
+        const EdgeInput& edge = input[i];
+        bool matched = false;
+        if(edge.v1 != edge.v2)
+        {
+            auto range = unmatched.equal_range(key(edge.v2, edge.v1));
+            for(auto it = range.first; it != range.second; ++it)
+            {
+                if(input[it->second].weight == edge.weight)
+                {
+                    unmatched.erase(it);
+                    matched = true;
+                    break;
+                }
+            }
+        }
+        if(matched)
+            continue;
+
+        input[kept] = edge;
+        unmatched.emplace(key(edge.v1, edge.v2), kept);
+        ++kept;
+    }
+    input.resize(kept);
+}
+
+using Graph = BasicGraph<int>;
+
 #endif /* GRAPH_HPP_ */
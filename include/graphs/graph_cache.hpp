@@ -0,0 +1,77 @@
+#ifndef GRAPH_CACHE_HPP_
+#define GRAPH_CACHE_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "graphs/edge_list.hpp"
+#include "graphs/weight_traits.hpp"
+
+/*
+ * Pamiec podreczna wczytanych plikow grafow wspolna dla calego procesu.
+ * Plik jest parsowany (loadEdgeList) przy pierwszym uzyciu, potem lista krawedzi jest zwracana z pamieci,
+ * dopoki rozmiar i czas modyfikacji pliku sie nie zmienia - kolejne wczytania tego samego pliku w testach
+ * i pomiarach pomijaja parsowanie. Dowolna reprezentacja jest budowana z listy przez createGraph(edgeList).
+ * Listy sa niezmienne i wspoldzielone (shared_ptr), wiec wynik pozostaje wazny po clear() lub odswiezeniu.
+ * Wszystkie metody mozna wywolywac z wielu watkow.
+ */
+template <typename W>
+class BasicGraphCache
+{
+    struct Entry
+    {
+        std::uintmax_t fileSize;
+        std::filesystem::file_time_type modified;
+        std::shared_ptr<const BasicEdgeList<W>> edgeList;
+    };
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries; // sciezka bezwzgledna -> wczytany plik
+    std::size_t hitCount = 0;
+    std::size_t missCount = 0;
+
+  public:
+    // Pamiec podreczna procesu dla wag typu W
+    static BasicGraphCache& instance();
+
+    // Lista krawedzi pliku, parsowana tylko przy pierwszym uzyciu i po zmianie pliku
+    std::shared_ptr<const BasicEdgeList<W>> edgeList(const std::filesystem::path& path);
+
+    // Graf reprezentacji G zbudowany z listy krawedzi pliku
+    template <typename G>
+    std::unique_ptr<BasicGraph<W>> load(const std::filesystem::path& path,
+                                        EdgeDirection direction = EdgeDirection::Directed)
+    {
+        return G::createGraph(*edgeList(path), direction);
+    }
+
+    void clear();
+    std::size_t size() const;
+    std::size_t hits() const;
+    std::size_t misses() const;
+};
+
+#define GRAPHS_DECLARE_GRAPH_CACHE(W) extern template class BasicGraphCache<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_GRAPH_CACHE)
+#undef GRAPHS_DECLARE_GRAPH_CACHE
+
+using GraphCache = BasicGraphCache<int>;
+
+// Skroty do pamieci podrecznej procesu
+template <typename W>
+std::shared_ptr<const BasicEdgeList<W>> loadCachedEdgeList(const std::filesystem::path& path)
+{
+    return BasicGraphCache<W>::instance().edgeList(path);
+}
+
+template <typename G>
+std::unique_ptr<BasicGraph<typename G::weight_type>> loadCachedGraph(const std::filesystem::path& path,
+                                                                     EdgeDirection direction = EdgeDirection::Directed)
+{
+    return BasicGraphCache<typename G::weight_type>::instance().template load<G>(path, direction);
+}
+
+#endif /* GRAPH_CACHE_HPP_ */
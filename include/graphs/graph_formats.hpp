@@ -0,0 +1,53 @@
+#ifndef GRAPH_FORMATS_HPP_
+#define GRAPH_FORMATS_HPP_
+
+#include <filesystem>
+#include <vector>
+#include "graphs/edge_list.hpp"
+#include "graphs/weight_traits.hpp"
+
+/*
+ * Importery popularnych formatow zbiorow grafow do BasicEdgeList, z ktorej createGraph(edgeList)
+ * buduje dowolna reprezentacje. Parsowanie jak w loadEdgeList: plik odwzorowany w pamieci
+ * i std::from_chars, bledy formatu jako ParseError z numerem linii.
+ * Identyfikatory wierzcholkow 1..n z plikow DIMACS i Matrix Market sa zamieniane na 0..n-1.
+ */
+
+// DIMACS shortest path (.gr): linie "c ..." (komentarz), "p sp n m", m linii "a u v waga"
+template <typename W>
+BasicEdgeList<W> parseDimacs(const char* begin, const char* end);
+
+template <typename W>
+BasicEdgeList<W> loadDimacs(const std::filesystem::path& path);
+
+// Matrix Market (.mtx), macierz "coordinate": niezerowy element (i, j) to krawedz i -> j.
+// Pole pattern daje wagi 1; macierz symmetric / skew-symmetric jest rozwijana do krawedzi w obu
+// kierunkach (j -> i z waga a lub -a), poza przekatna; musi byc kwadratowa i zawierac tylko dolny trojkat
+// (skew-symmetric - bez przekatnej). Liczba wierzcholkow to max(wiersze, kolumny).
+template <typename W>
+BasicEdgeList<W> parseMatrixMarket(const char* begin, const char* end);
+
+template <typename W>
+BasicEdgeList<W> loadMatrixMarket(const std::filesystem::path& path);
+
+// Lista krawedzi SNAP: linie "# ..." (komentarz) i "u v" lub "u v waga" (brak wagi - 1), identyfikatory
+// nieujemne. Identyfikatory sa rzadkie, wiec sa zamieniane na indeksy 0..n-1 w kolejnosci rosnacej,
+// gdzie n to liczba roznych identyfikatorow w krawedziach (bez izolowanych wierzcholkow);
+// vertexIds (opcjonalnie) dostaje indeks -> identyfikator z pliku.
+template <typename W>
+BasicEdgeList<W> parseSnapEdgeList(const char* begin, const char* end, std::vector<int>* vertexIds = nullptr);
+
+template <typename W>
+BasicEdgeList<W> loadSnapEdgeList(const std::filesystem::path& path, std::vector<int>* vertexIds = nullptr);
+
+#define GRAPHS_DECLARE_GRAPH_FORMATS(W)                                                                                \
+    extern template BasicEdgeList<W> parseDimacs(const char*, const char*);                                           \
+    extern template BasicEdgeList<W> loadDimacs(const std::filesystem::path&);                                        \
+    extern template BasicEdgeList<W> parseMatrixMarket(const char*, const char*);                                     \
+    extern template BasicEdgeList<W> loadMatrixMarket(const std::filesystem::path&);                                  \
+    extern template BasicEdgeList<W> parseSnapEdgeList(const char*, const char*, std::vector<int>*);                  \
+    extern template BasicEdgeList<W> loadSnapEdgeList(const std::filesystem::path&, std::vector<int>*);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_GRAPH_FORMATS)
+#undef GRAPHS_DECLARE_GRAPH_FORMATS
+
+#endif /* GRAPH_FORMATS_HPP_ */
@@ -0,0 +1,135 @@
+#ifndef INDEXED_HEAP_HPP_
+#define INDEXED_HEAP_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/*
+ * Indeksowany kopiec d-arny (minimum na szczycie) elementow 0..capacity-1 z kluczami typu Key.
+ * Pozycje elementow w kopcu leza w plaskiej tablicy, wiec decreaseKey zmienia klucz w miejscu zamiast
+ * wstawiac kolejna kopie (jak przy leniwym usuwaniu) - kopiec ma co najwyzej capacity elementow.
+ * Wezly kopca trzymaja klucz razem z elementem, wiec porownania przy przesiewaniu czytaja jedna ciagla tablice.
+ * Arity (>= 2) ustala liczbe dzieci wezla: wieksza skraca kopiec i przyspiesza decreaseKey kosztem pop.
+ */
+template <typename Key, int Arity = 4>
+class IndexedHeap
+{
+    static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+    struct Node
+    {
+        Key key;
+        int item;
+    };
+
+    static constexpr int NotInHeap = -1;
+    static constexpr int Removed = -2;
+
+    std::vector<Node> nodes;
+    std::vector<int> positions; // element -> pozycja w nodes, NotInHeap albo Removed
+
+    void place(std::size_t position, const Node& node)
+    {
+        nodes[position] = node;
+        positions[node.item] = static_cast<int>(position);
+    }
+
+    void siftUp(std::size_t position)
+    {
+        Node node = nodes[position];
+        while(position > 0)
+        {
+            std::size_t parent = (position - 1) / Arity;
+            if(!(node.key < nodes[parent].key))
+                break;
+            place(position, nodes[parent]);
+            position = parent;
+        }
+        place(position, node);
+    }
+
+    void siftDown(std::size_t position)
+    {
+        Node node = nodes[position];
+        std::size_t size = nodes.size();
+        for(;;)
+        {
+            std::size_t first = position * Arity + 1;
+            if(first >= size)
+                break;
+
+            std::size_t last = first + Arity < size ? first + Arity : size;
+            std::size_t best = first;
+            for(std::size_t child = first + 1; child < last; ++child)
+            {
+                if(nodes[child].key < nodes[best].key)
+                    best = child;
+            }
+            if(!(nodes[best].key < node.key))
+                break;
+            place(position, nodes[best]);
+            position = best;
+        }
+        place(position, node);
+    }
+
+  public:
+    explicit IndexedHeap(int capacity) : positions(capacity, NotInHeap) { nodes.reserve(capacity); }
+
+    bool empty() const { return nodes.empty(); }
+    std::size_t size() const { return nodes.size(); }
+
+    // Element jest w kopcu / zostal z niego zdjety przez pop
+    bool contains(int item) const { return positions[item] >= 0; }
+    bool wasRemoved(int item) const { return positions[item] == Removed; }
+
+    int topItem() const { return nodes.front().item; }
+    Key topKey() const { return nodes.front().key; }
+
+    // Element nie moze byc w kopcu.
+    // Złożoność czasowa: O(log_d n), pamięciowa: O(1)
+    void push(int item, Key key)
+    {
+        nodes.push_back({key, item});
+        siftUp(nodes.size() - 1);
+    }
+
+    // Nowy klucz nie moze byc wiekszy od obecnego.
+    // Złożoność czasowa: O(log_d n), pamięciowa: O(1)
+    void decreaseKey(int item, Key key)
+    {
+        std::size_t position = positions[item];
+        nodes[position].key = key;
+        siftUp(position);
+    }
+
+    // Zdejmuje element o najmniejszym kluczu i zwraca go.
+    // Złożoność czasowa: O(d log_d n), pamięciowa: O(1)
+    int pop()
+    {
+        int item = nodes.front().item;
+        positions[item] = Removed;
+        Node last = nodes.back();
+        nodes.pop_back();
+        if(!nodes.empty())
+        {
+            nodes.front() = last;
+            siftDown(0);
+        }
+        return item;
+    }
+
+    // Oproznia kopiec; items to wszystkie elementy wstawione od poprzedniego reset, wiec ponowne uzycie
+    // kopca kosztuje tyle, ile elementow dotknelo poprzednie przeszukiwanie, a nie capacity.
+    // Złożoność czasowa: O(|items|), pamięciowa: O(1)
+    void reset(const std::vector<int>& items)
+    {
+        nodes.clear();
+        for(int item : items)
+        {
+            positions[item] = NotInHeap;
+        }
+    }
+};
+
+#endif /* INDEXED_HEAP_HPP_ */
@@ -0,0 +1,49 @@
+#ifndef MAPPED_FILE_HPP_
+#define MAPPED_FILE_HPP_
+
+#include <cstddef>
+#include <filesystem>
+
+/*
+ * Plik odwzorowany w pamieci tylko do odczytu (mmap na POSIX, CreateFileMapping na Windows).
+ * Zawartosc jest dostepna jako ciagly bufor [data(), data() + size()) bez kopiowania do pamieci procesu;
+ * odwzorowanie jest zwalniane w destruktorze. Pusty plik daje pusty bufor (data() == nullptr).
+ * Wzorzec dostepu jest podpowiedzia dla systemu (madvise / flagi CreateFile) o tym, jak czytac plik z wyprzedzeniem.
+ */
+class MappedFile
+{
+  public:
+    enum class AccessPattern
+    {
+        Sequential, // jeden przebieg od poczatku do konca (parsery plikow tekstowych)
+        Random,     // odczyty w dowolnej kolejnosci, bez czytania z wyprzedzeniem
+        Normal      // domyslne zachowanie systemu, np. sprawdzenie calosci, a potem dostep swobodny
+    };
+
+  private:
+    const char* mappedData = nullptr;
+    std::size_t mappedSize = 0;
+#if defined(_WIN32)
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+
+    void close();
+
+  public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& path, AccessPattern access = AccessPattern::Sequential);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    const char* data() const { return mappedData; }
+    std::size_t size() const { return mappedSize; }
+    const char* begin() const { return mappedData; }
+    const char* end() const { return mappedData + mappedSize; }
+};
+
+#endif /* MAPPED_FILE_HPP_ */
@@ -1,30 +1,50 @@
 #ifndef MINIMUM_SPANNING_TREE_ALGORITHMS_HPP_
 #define MINIMUM_SPANNING_TREE_ALGORITHMS_HPP_
 
+#include "graphs/edge_stream.hpp"
 #include "graphs/graph.hpp"
+#include <algorithm>
 #include <vector>
 
-struct MinimumSpanningEdge {
+template <typename W>
+struct BasicMinimumSpanningEdge {
     int v1;
     int v2;
-    int weight;
+    W weight;
 
-    bool operator<(const MinimumSpanningEdge &edge) const {
+    bool operator<(const BasicMinimumSpanningEdge &edge) const {
         return std::min(v1, v2) != std::min(edge.v1, edge.v2) ? std::min(v1, v2) < std::min(edge.v1, edge.v2) :
                std::max(v1, v2) < std::max(edge.v1, edge.v2);
     }
 
-    bool operator==(const MinimumSpanningEdge &edge) const {
+    bool operator==(const BasicMinimumSpanningEdge &edge) const {
         return std::min(v1, v2) == std::min(edge.v1, edge.v2) && std::max(v1, v2) == std::max(edge.v1, edge.v2) &&
                weight == edge.weight;
     }
 };
 
-using MinimumSpanningTreeResult = std::vector<MinimumSpanningEdge>;
+template <typename W>
+using BasicMinimumSpanningTreeResult = std::vector<BasicMinimumSpanningEdge<W>>;
 
-void kruskal(Graph &graph, MinimumSpanningTreeResult &result);
+using MinimumSpanningEdge = BasicMinimumSpanningEdge<int>;
+using MinimumSpanningTreeResult = BasicMinimumSpanningTreeResult<int>;
 
-void prim(Graph &graph, MinimumSpanningTreeResult &result);
+template <typename W>
+void kruskal(BasicGraph<W> &graph, BasicMinimumSpanningTreeResult<W> &result);
+
+template <typename W>
+void prim(BasicGraph<W> &graph, BasicMinimumSpanningTreeResult<W> &result);
+
+// Kruskal na strumieniu krawedzi czytanym porcjami po batchSize krawedzi: pamiec O(V + batchSize)
+// niezaleznie od E. Wynik jak z kruskal dla grafu z krawedziami w kolejnosci strumienia.
+template <typename W>
+void kruskal(BasicEdgeStream<W> &stream, BasicMinimumSpanningTreeResult<W> &result,
+             std::size_t batchSize = 1 << 16);
+
+// Spojne skladowe (krawedzie bez kierunku) ze strumienia krawedzi. component[v] dostaje numer
+// skladowej 0..k-1, numerowanych w kolejnosci najmniejszego wierzcholka; zwraca k.
+template <typename W>
+int connectedComponents(BasicEdgeStream<W> &stream, std::vector<int> &component, std::size_t batchSize = 1 << 16);
 
 #endif /* MINIMUM_SPANNING_TREE_ALGORITHMS_HPP_ */
 
@@ -0,0 +1,117 @@
+#ifndef PACKED_WEIGHTS_HPP_
+#define PACKED_WEIGHTS_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Tablica wag krawedzi upakowana na bajty. Wagi calkowite sa zapisywane jako przesuniecie od najmniejszej
+// wagi na 0, 1, 2, 4 lub 8 bajtach (tyle, ile wymaga rozpietosc wag; 0 - wszystkie wagi rowne),
+// zmiennoprzecinkowe bez zmian.
+template <typename W>
+class PackedWeights
+{
+    std::vector<std::uint8_t> bytes;
+    int width = 0;
+    W base{};
+
+    template <typename T>
+    static T load(const std::uint8_t* data)
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void append(T value)
+    {
+        std::uint8_t raw[sizeof(T)];
+        std::memcpy(raw, &value, sizeof(T));
+        bytes.insert(bytes.end(), raw, raw + sizeof(T));
+    }
+
+    // Waga calkowita zapisana jako przesuniecie od base (modulo 2^64)
+    W decode(std::uint64_t stored) const { return static_cast<W>(static_cast<std::uint64_t>(base) + stored); }
+
+  public:
+    PackedWeights() = default;
+
+    // Złożoność czasowa: O(n), pamięciowa: O(n * width)
+    explicit PackedWeights(const std::vector<W>& weights)
+    {
+        if constexpr(std::is_floating_point_v<W>)
+        {
+            width = sizeof(W);
+            bytes.reserve(weights.size() * sizeof(W));
+            for(W weight : weights)
+            {
+                append(weight);
+            }
+        }
+        else
+        {
+            if(weights.empty())
+                return;
+
+            auto [minWeight, maxWeight] = std::minmax_element(weights.begin(), weights.end());
+            base = *minWeight;
+            std::uint64_t range = static_cast<std::uint64_t>(*maxWeight) - static_cast<std::uint64_t>(base);
+            width = range == 0 ? 0 : range <= 0xff ? 1 : range <= 0xffff ? 2 : range <= 0xffffffff ? 4 : 8;
+
+            bytes.reserve(weights.size() * width);
+            for(W weight : weights)
+            {
+                std::uint64_t offset = static_cast<std::uint64_t>(weight) - static_cast<std::uint64_t>(base);
+                switch(width)
+                {
+                case 0:
+                    break;
+                case 1:
+                    bytes.push_back(static_cast<std::uint8_t>(offset));
+                    break;
+                case 2:
+                    append(static_cast<std::uint16_t>(offset));
+                    break;
+                case 4:
+                    append(static_cast<std::uint32_t>(offset));
+                    break;
+                default:
+                    append(offset);
+                }
+            }
+        }
+    }
+
+    // Złożoność czasowa: O(1)
+    W operator[](std::size_t i) const
+    {
+        const std::uint8_t* data = bytes.data() + i * width;
+        if constexpr(std::is_floating_point_v<W>)
+        {
+            return load<W>(data);
+        }
+        else
+        {
+            switch(width)
+            {
+            case 0:
+                return base;
+            case 1:
+                return decode(data[0]);
+            case 2:
+                return decode(load<std::uint16_t>(data));
+            case 4:
+                return decode(load<std::uint32_t>(data));
+            default:
+                return decode(load<std::uint64_t>(data));
+            }
+        }
+    }
+
+    std::size_t memoryUsage() const { return bytes.size(); }
+};
+
+#endif /* PACKED_WEIGHTS_HPP_ */
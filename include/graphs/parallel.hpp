@@ -0,0 +1,62 @@
+#ifndef PARALLEL_HPP_
+#define PARALLEL_HPP_
+
+#include <algorithm>
+#include <exception>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Liczba watkow do uzycia: requested > 0 bez zmian, w przeciwnym razie liczba rdzeni
+inline int resolveThreadCount(int requested)
+{
+    if(requested > 0)
+        return requested;
+    return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+// Wywoluje task(t) dla t = 0..threadCount-1, kazde w osobnym watku (t = 0 w watku wolajacym),
+// i czeka na wszystkie. Pierwszy wyjatek z zadan jest rzucany dalej po zakonczeniu wszystkich watkow.
+template <typename Task>
+void parallelFor(int threadCount, Task&& task)
+{
+    std::vector<std::exception_ptr> errors(threadCount);
+    auto run = [&task, &errors](int t) {
+        try
+        {
+            task(t);
+        }
+        catch(...)
+        {
+            errors[t] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount > 0 ? threadCount - 1 : 0);
+    for(int t = 1; t < threadCount; ++t)
+    {
+        workers.emplace_back(run, t);
+    }
+    if(threadCount > 0)
+        run(0);
+    for(auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    for(auto& error : errors)
+    {
+        if(error)
+            std::rethrow_exception(error);
+    }
+}
+
+// Zakres [begin, end) elementow przypadajacy na zadanie t z threadCount przy podziale count elementow
+inline std::pair<std::size_t, std::size_t> chunkRange(std::size_t count, int t, int threadCount)
+{
+    return {count * t / threadCount, count * (t + 1) / threadCount};
+}
+
+#endif /* PARALLEL_HPP_ */
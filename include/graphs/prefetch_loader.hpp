@@ -0,0 +1,85 @@
+#ifndef PREFETCH_LOADER_HPP_
+#define PREFETCH_LOADER_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "graphs/edge_list.hpp"
+#include "graphs/weight_traits.hpp"
+
+/*
+ * Wczytywanie serii plikow grafow z wyprzedzeniem, np. do pomiarow na calym katalogu danych.
+ * Watek w tle parsuje kolejne pliki (loadEdgeList) do kolejki o ograniczonej pojemnosci, podczas gdy
+ * watek wolajacy wykonuje algorytm na poprzednim pliku; next() czeka tylko wtedy, gdy parsowanie
+ * jest wolniejsze od algorytmu. Pojemnosc ogranicza liczbe list wczytanych z wyprzedzeniem (w kolejce,
+ * parsowanej i przekazywanej w next()); razem z lista trzymana przez wolajacego w pamieci jest naraz
+ * co najwyzej capacity + 1 list krawedzi.
+ * Blad parsowania pliku jest rzucany z next() dla tego pliku; kolejne wywolania zwracaja nastepne pliki.
+ * Destruktor przerywa wczytywanie (biezacy plik jest parsowany do konca) i czeka na watek.
+ */
+template <typename W>
+class BasicPrefetchLoader
+{
+  public:
+    struct Item
+    {
+        std::filesystem::path path;
+        BasicEdgeList<W> edgeList;
+    };
+
+  private:
+    struct Slot
+    {
+        Item item;
+        std::exception_ptr error;
+    };
+
+    std::vector<std::filesystem::path> files;
+    std::size_t capacity;
+
+    std::mutex mutex;
+    std::condition_variable itemReady; // dla next()
+    std::condition_variable slotFree;  // dla watku wczytujacego
+    std::deque<Slot> queue;
+    std::size_t reserved = 0; // listy w kolejce, parsowana i przekazywana w next(); <= capacity
+    bool finished = false;
+    bool stopping = false;
+
+    std::thread worker; // ostatnie pole: watek startuje po inicjalizacji pozostalych
+
+    void run();
+
+  public:
+    // Pliki w zadanej kolejnosci; capacity >= 1 - liczba plikow wczytanych z wyprzedzeniem
+    explicit BasicPrefetchLoader(std::vector<std::filesystem::path> files, std::size_t capacity = 2);
+    // Pliki regularne katalogu o rozszerzeniu extension, w kolejnosci nazw
+    BasicPrefetchLoader(const std::filesystem::path& directory, const std::string& extension,
+                        std::size_t capacity = 2);
+    ~BasicPrefetchLoader();
+
+    BasicPrefetchLoader(const BasicPrefetchLoader&) = delete;
+    BasicPrefetchLoader& operator=(const BasicPrefetchLoader&) = delete;
+
+    // Przekazuje nastepny wczytany plik do item; false, gdy plikow juz nie ma
+    bool next(Item& item);
+
+    const std::vector<std::filesystem::path>& paths() const { return files; }
+};
+
+// Pliki regularne katalogu o rozszerzeniu extension (puste - wszystkie), posortowane po nazwie
+std::vector<std::filesystem::path> listDatasetFiles(const std::filesystem::path& directory,
+                                                    const std::string& extension = ".txt");
+
+#define GRAPHS_DECLARE_PREFETCH_LOADER(W) extern template class BasicPrefetchLoader<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_PREFETCH_LOADER)
+#undef GRAPHS_DECLARE_PREFETCH_LOADER
+
+using PrefetchLoader = BasicPrefetchLoader<int>;
+
+#endif /* PREFETCH_LOADER_HPP_ */
@@ -0,0 +1,444 @@
+#ifndef READ_ONLY_GRAPH_HPP_
+#define READ_ONLY_GRAPH_HPP_
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "graphs/edge_list.hpp"
+#include "graphs/graph.hpp"
+#include "graphs/packed_weights.hpp"
+#include "graphs/weight_traits.hpp"
+
+/*
+ * Wspolna czesc niezmiennych grafow skierowanych o gestych indeksach wierzcholkow (CompressedGraph,
+ * SuccinctGraph): mapowanie identyfikatorow, budowa z listy krawedzi lub innego grafu, metody uaktualniajace
+ * rzucajace logic_error i iteracja po nastepnikach. Krawedzie maja identyfikatory 0..m-1 w kolejnosci
+ * (poczatek, koniec, kolejnosc wstawienia), wiec krawedzie wychodzace z wierzcholka to ciagly zakres.
+ *
+ * Derived dostarcza kodowanie krawedzi:
+ *   static constexpr const char* typeName, printTitle - nazwa w komunikatach bledow i naglowek printGraph,
+ *   static std::unique_ptr<Derived> build(ids, sources, targets, weights) - buduje graf (przez assignEdges),
+ *   neighbors(index) - kursor z next(), target() i edge() po nastepnikach w kolejnosci rosnacej,
+ *   firstEdge(index) - pierwszy identyfikator krawedzi wierzcholka (index <= n),
+ *   sourceIndex(e), targetIndex(e) - indeksy koncow krawedzi,
+ *   inEdges, forEachInNeighbor, areAdjacent.
+ */
+template <typename Derived, typename W>
+class BasicReadOnlyGraph : public BasicGraph<W>
+{
+    const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+    [[noreturn]] static void throwReadOnly()
+    {
+        throw std::logic_error(std::string(Derived::typeName) + " is read-only");
+    }
+
+    static void requireDirected(bool directed)
+    {
+        if(!directed)
+        {
+            throw std::invalid_argument(std::string(Derived::typeName) + " stores directed graphs only");
+        }
+    }
+
+  protected:
+    int vertexCount = 0;
+    int edgeCount = 0;
+
+    std::vector<int> vertexIds;                 // indeks -> identyfikator wierzcholka
+    std::unordered_map<int, int> vertexIndices; // identyfikator -> indeks (puste, gdy identycznosc)
+
+    PackedWeights<W> weights; // w kolejnosci identyfikatorow krawedzi
+
+    std::vector<int> assignEdges(std::vector<int> ids, const std::vector<int>& sources,
+                                 const std::vector<int>& targets, const std::vector<W>& inputWeights,
+                                 std::vector<int>& edgeOffsets);
+
+    void checkEdge(int e) const;
+
+    // Pamiec zajmowana przez identyfikatory wierzcholkow i wagi w bajtach
+    std::size_t sharedMemoryUsage() const;
+
+  public:
+    // Update methods
+    int insertVertex(int = 0) override { throwReadOnly(); }
+    int insertEdge(int, int, W) override { throwReadOnly(); }
+    void removeVertex(int) override { throwReadOnly(); }
+    void removeEdge(int) override { throwReadOnly(); }
+    int insertVertices(int) override { throwReadOnly(); }
+    int insertEdges(Span<const typename BasicGraph<W>::EdgeInput>) override { throwReadOnly(); }
+
+    // Iteration methods
+    std::vector<int> showVertices() const override;
+    std::vector<int> showEdges() const override;
+    std::vector<int> incidentEdges(int v) const override;
+    std::vector<int> outEdges(int v) const override;
+
+    // Access methods
+    std::vector<int> endVertices(int edge) const override;
+    int opposite(int v, int e) const override;
+    W edgeWeight(int e) const override;
+    void replaceVertices(int, int) override { throwReadOnly(); }
+    void replaceEdges(int, W) override { throwReadOnly(); }
+    bool isDirected() const override { return true; }
+
+    // Non-allocating access methods
+    int numVertices() const override { return vertexCount; }
+    int numEdges() const override { return edgeCount; }
+    std::pair<int, int> endpoints(int e) const override;
+    void forEachVertex(FunctionRef<void(int v)> visit) const override;
+    void forEachEdge(typename BasicGraph<W>::EdgeVisitor visit) const override;
+    void forEachOutNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const override;
+
+    void printGraph() const override;
+
+    // Dostep po gestych indeksach wierzcholkow
+    int indexOf(int v) const;
+    int vertexAt(int index) const { return vertexIds[index]; }
+
+    // Waga krawedzi o identyfikatorze e, bez sprawdzania zakresu
+    W weight(int e) const { return weights[e]; }
+
+    static std::unique_ptr<Derived> fromGraph(const BasicGraph<W>& graph);
+    static std::unique_ptr<BasicGraph<W>> createGraph(std::istream& is,
+                                                      EdgeDirection direction = EdgeDirection::Directed);
+    static std::unique_ptr<BasicGraph<W>> createGraph(const BasicEdgeList<W>& edgeList,
+                                                      EdgeDirection direction = EdgeDirection::Directed);
+};
+
+// Ustawia wierzcholki i wagi grafu z krawedzi podanych w kolejnosci wstawienia (sources / targets to gesto
+// numerowane indeksy). Krawedzie sa porzadkowane stabilnie po poczatku (sortowanie przez zliczanie), a w obrebie
+// wierzcholka stabilnie po koncu. Zwraca order: nowy identyfikator -> pozycja krawedzi na wejsciu, a w edgeOffsets
+// zapisuje pierwszy nowy identyfikator krawedzi kazdego wierzcholka (n + 1 pozycji).
+// Złożoność czasowa: O(V + E log d_max), pamięciowa: O(V + E)
+template <typename Derived, typename W>
+std::vector<int> BasicReadOnlyGraph<Derived, W>::assignEdges(std::vector<int> ids, const std::vector<int>& sources,
+                                                             const std::vector<int>& targets,
+                                                             const std::vector<W>& inputWeights,
+                                                             std::vector<int>& edgeOffsets)
+{
+    int n = static_cast<int>(ids.size());
+    int m = static_cast<int>(sources.size());
+    vertexCount = n;
+    edgeCount = m;
+
+    edgeOffsets.assign(n + 1, 0);
+    for(int source : sources)
+    {
+        ++edgeOffsets[source + 1];
+    }
+    std::partial_sum(edgeOffsets.begin(), edgeOffsets.end(), edgeOffsets.begin());
+
+    std::vector<int> order(m);
+    std::vector<int> next(edgeOffsets.begin(), edgeOffsets.end() - 1);
+    for(int e = 0; e < m; ++e)
+    {
+        order[next[sources[e]]++] = e;
+    }
+    for(int u = 0; u < n; ++u)
+    {
+        std::stable_sort(order.begin() + edgeOffsets[u], order.begin() + edgeOffsets[u + 1],
+                         [&targets](int a, int b) { return targets[a] < targets[b]; });
+    }
+
+    std::vector<W> ordered(m);
+    for(int e = 0; e < m; ++e)
+    {
+        ordered[e] = inputWeights[order[e]];
+    }
+    weights = PackedWeights<W>(ordered);
+
+    for(int i = 0; i < n; ++i)
+    {
+        if(ids[i] != i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                vertexIndices[ids[j]] = j;
+            }
+            break;
+        }
+    }
+    vertexIds = std::move(ids);
+    return order;
+}
+
+// Tworzy kopie grafu skierowanego; wierzcholki rosnaco po identyfikatorze.
+// Złożoność czasowa: O(V log V + E log E), pamięciowa: O(V + E)
+template <typename Derived, typename W>
+std::unique_ptr<Derived> BasicReadOnlyGraph<Derived, W>::fromGraph(const BasicGraph<W>& graph)
+{
+    requireDirected(graph.isDirected());
+
+    std::vector<int> ids = graph.showVertices();
+    std::sort(ids.begin(), ids.end());
+
+    std::unordered_map<int, int> indices;
+    indices.reserve(ids.size());
+    for(int i = 0; i < static_cast<int>(ids.size()); ++i)
+    {
+        indices[ids[i]] = i;
+    }
+
+    struct InputEdge
+    {
+        int id, source, target;
+        W weight;
+    };
+    std::vector<InputEdge> input;
+    input.reserve(graph.numEdges());
+    graph.forEachEdge([&input, &indices](int e, int v1, int v2, W weight) {
+        input.push_back({e, indices.at(v1), indices.at(v2), weight});
+    });
+    std::sort(input.begin(), input.end(), [](const InputEdge& a, const InputEdge& b) { return a.id < b.id; });
+
+    std::vector<int> sources(input.size()), targets(input.size());
+    std::vector<W> inputWeights(input.size());
+    for(std::size_t i = 0; i < input.size(); ++i)
+    {
+        sources[i] = input[i].source;
+        targets[i] = input[i].target;
+        inputWeights[i] = input[i].weight;
+    }
+    return Derived::build(std::move(ids), sources, targets, inputWeights);
+}
+
+// Tworzy graf na podstawie danych wejściowych ze strumienia is (format "V E", potem E linii "v1 v2 waga").
+// Złożoność czasowa: O(V + E log d_max), pamięciowa: O(V + E)
+template <typename Derived, typename W>
+std::unique_ptr<BasicGraph<W>> BasicReadOnlyGraph<Derived, W>::createGraph(std::istream& is,
+                                                                          EdgeDirection direction)
+{
+    requireDirected(direction == EdgeDirection::Directed);
+
+    BasicEdgeList<W> edgeList;
+    int count;
+    is >> edgeList.vertexCount >> count;
+    if(!is || edgeList.vertexCount < 0 || count < 0)
+    {
+        throw std::invalid_argument("Invalid input format");
+    }
+
+    edgeList.edges.resize(count);
+    for(auto& edge : edgeList.edges)
+    {
+        is >> edge.v1 >> edge.v2;
+        edge.weight = readWeight<W>(is);
+        if(!is)
+        {
+            throw std::invalid_argument("Invalid edge format");
+        }
+    }
+    return createGraph(edgeList, direction);
+}
+
+// Złożoność czasowa: O(V + E log d_max), pamięciowa: O(V + E)
+template <typename Derived, typename W>
+std::unique_ptr<BasicGraph<W>> BasicReadOnlyGraph<Derived, W>::createGraph(const BasicEdgeList<W>& edgeList,
+                                                                          EdgeDirection direction)
+{
+    requireDirected(direction == EdgeDirection::Directed);
+    if(edgeList.vertexCount < 0)
+    {
+        throw std::invalid_argument("Invalid input format");
+    }
+
+    std::vector<int> sources(edgeList.edges.size()), targets(edgeList.edges.size());
+    std::vector<W> inputWeights(edgeList.edges.size());
+    for(std::size_t e = 0; e < edgeList.edges.size(); ++e)
+    {
+        const auto& edge = edgeList.edges[e];
+        if(edge.v1 < 0 || edge.v1 >= edgeList.vertexCount || edge.v2 < 0 || edge.v2 >= edgeList.vertexCount)
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        sources[e] = edge.v1;
+        targets[e] = edge.v2;
+        inputWeights[e] = edge.weight;
+    }
+
+    std::vector<int> ids(edgeList.vertexCount);
+    std::iota(ids.begin(), ids.end(), 0);
+    return Derived::build(std::move(ids), sources, targets, inputWeights);
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename Derived, typename W>
+int BasicReadOnlyGraph<Derived, W>::indexOf(int v) const
+{
+    if(vertexIndices.empty())
+    {
+        if(v < 0 || v >= vertexCount)
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        return v;
+    }
+
+    auto it = vertexIndices.find(v);
+    if(it == vertexIndices.end())
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    return it->second;
+}
+
+template <typename Derived, typename W>
+void BasicReadOnlyGraph<Derived, W>::checkEdge(int e) const
+{
+    if(e < 0 || e >= edgeCount)
+    {
+        throw std::runtime_error("Edge does not exist");
+    }
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename Derived, typename W>
+std::size_t BasicReadOnlyGraph<Derived, W>::sharedMemoryUsage() const
+{
+    return vertexIds.size() * sizeof(int) + vertexIndices.size() * 2 * sizeof(int) + weights.memoryUsage();
+}
+
+// metody iterujace
+
+// Złożoność czasowa: O(V), pamięciowa: O(V)
+template <typename Derived, typename W>
+std::vector<int> BasicReadOnlyGraph<Derived, W>::showVertices() const
+{
+    return vertexIds;
+}
+
+// Złożoność czasowa: O(E), pamięciowa: O(E)
+template <typename Derived, typename W>
+std::vector<int> BasicReadOnlyGraph<Derived, W>::showEdges() const
+{
+    std::vector<int> result(edgeCount);
+    std::iota(result.begin(), result.end(), 0);
+    return result;
+}
+
+// Krawedzie wychodzace, a potem wchodzace do v. Petla wlasna lezy w zakresie krawedzi wychodzacych,
+// wiec z krawedzi wchodzacych pomijane sa identyfikatory z tego zakresu.
+// Złożoność czasowa: O(d) + koszt inEdges, pamięciowa: O(d)
+template <typename Derived, typename W>
+std::vector<int> BasicReadOnlyGraph<Derived, W>::incidentEdges(int v) const
+{
+    int u = indexOf(v);
+    int first = derived().firstEdge(u), last = derived().firstEdge(u + 1);
+    std::vector<int> result = outEdges(v);
+    for(int e : derived().inEdges(v))
+    {
+        if(e < first || e >= last)
+            result.push_back(e);
+    }
+    return result;
+}
+
+// Złożoność czasowa: O(d_out), pamięciowa: O(d_out)
+template <typename Derived, typename W>
+std::vector<int> BasicReadOnlyGraph<Derived, W>::outEdges(int v) const
+{
+    int u = indexOf(v);
+    std::vector<int> result(derived().firstEdge(u + 1) - derived().firstEdge(u));
+    std::iota(result.begin(), result.end(), derived().firstEdge(u));
+    return result;
+}
+
+// metody dostepu
+
+// Złożoność czasowa: jak endpoints, pamięciowa: O(1)
+template <typename Derived, typename W>
+std::vector<int> BasicReadOnlyGraph<Derived, W>::endVertices(int edge) const
+{
+    auto [v1, v2] = endpoints(edge);
+    return {v1, v2};
+}
+
+// Złożoność czasowa: jak endpoints, pamięciowa: O(1)
+template <typename Derived, typename W>
+int BasicReadOnlyGraph<Derived, W>::opposite(int v, int e) const
+{
+    auto [v1, v2] = endpoints(e);
+    if(v1 == v)
+        return v2;
+    else if(v2 == v)
+        return v1;
+
+    throw std::runtime_error("Vertex does not belong to the edge");
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename Derived, typename W>
+W BasicReadOnlyGraph<Derived, W>::edgeWeight(int e) const
+{
+    checkEdge(e);
+    return weight(e);
+}
+
+// metody bez alokacji
+
+// Złożoność czasowa: koszt sourceIndex i targetIndex, pamięciowa: O(1)
+template <typename Derived, typename W>
+std::pair<int, int> BasicReadOnlyGraph<Derived, W>::endpoints(int e) const
+{
+    checkEdge(e);
+    return {vertexIds[derived().sourceIndex(e)], vertexIds[derived().targetIndex(e)]};
+}
+
+// Złożoność czasowa: O(V), pamięciowa: O(1)
+template <typename Derived, typename W>
+void BasicReadOnlyGraph<Derived, W>::forEachVertex(FunctionRef<void(int v)> visit) const
+{
+    for(int id : vertexIds)
+    {
+        visit(id);
+    }
+}
+
+// Krawędzie w kolejności identyfikatorów.
+// Złożoność czasowa: O(V + E), pamięciowa: O(1)
+template <typename Derived, typename W>
+void BasicReadOnlyGraph<Derived, W>::forEachEdge(typename BasicGraph<W>::EdgeVisitor visit) const
+{
+    for(int u = 0; u < vertexCount; ++u)
+    {
+        for(auto cursor = derived().neighbors(u); cursor.next();)
+        {
+            visit(cursor.edge(), vertexIds[u], vertexIds[cursor.target()], weight(cursor.edge()));
+        }
+    }
+}
+
+// Złożoność czasowa: O(d_out), pamięciowa: O(1)
+template <typename Derived, typename W>
+void BasicReadOnlyGraph<Derived, W>::forEachOutNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const
+{
+    for(auto cursor = derived().neighbors(indexOf(v)); cursor.next();)
+    {
+        visit(vertexIds[cursor.target()], cursor.edge(), weight(cursor.edge()));
+    }
+}
+
+template <typename Derived, typename W>
+void BasicReadOnlyGraph<Derived, W>::printGraph() const
+{
+    std::cout << "\n=== REPREZENTACJA GRAFU (" << Derived::printTitle << ") ===\n";
+    std::cout << vertexCount << " " << edgeCount << std::endl;
+
+    for(int u = 0; u < vertexCount; ++u)
+    {
+        std::cout << "  " << vertexIds[u] << ": ";
+        for(auto cursor = derived().neighbors(u); cursor.next();)
+        {
+            std::cout << vertexIds[cursor.target()] << "(" << printableWeight(weight(cursor.edge())) << ", "
+                      << cursor.edge() << ") ";
+        }
+        std::cout << "\n";
+    }
+}
+
+#endif /* READ_ONLY_GRAPH_HPP_ */
@@ -0,0 +1,77 @@
+#ifndef RESULT_IO_HPP_
+#define RESULT_IO_HPP_
+
+#include <filesystem>
+#include <istream>
+#include <ostream>
+#include "graphs/minimum_spanning_tree_algorithms.hpp"
+#include "graphs/shortest_path_algorithms.hpp"
+#include "graphs/weight_traits.hpp"
+
+/*
+ * Zapis i odczyt wynikow algorytmow.
+ * Format tekstowy jak w plikach referencyjnych:
+ *   najkrotsze sciezki (sp_result) - linia "koniec koszt v0 v1 ... koniec" na kazdy osiagalny wierzcholek,
+ *   drzewo rozpinajace (mstResults) - linia "v1 v2 waga" na kazda krawedz.
+ * Tekst jest skladany w duzym buforze przez std::to_chars i czytany jednym blokiem (plik odwzorowany
+ * w pamieci albo caly strumien) przez std::from_chars; bledy formatu zglaszane sa jako ParseError.
+ * Format binarny (natywna kolejnosc bajtow): naglowek z magic, wersja i kodem typu wartosci, potem tablice
+ * kolumn wyniku zapisywane i czytane w calosci. Bledny plik binarny daje std::runtime_error.
+ */
+
+// Shortest path results, text
+template <typename D>
+void writeShortestPathResult(std::ostream& os, const BasicShortestPathResult<D>& result);
+template <typename D>
+void readShortestPathResult(std::istream& is, BasicShortestPathResult<D>& result);
+template <typename D>
+BasicShortestPathResult<D> parseShortestPathResult(const char* begin, const char* end);
+template <typename D>
+void saveShortestPathResult(const BasicShortestPathResult<D>& result, const std::filesystem::path& path);
+template <typename D>
+BasicShortestPathResult<D> loadShortestPathResult(const std::filesystem::path& path);
+
+// Shortest path results, binary
+template <typename D>
+void saveShortestPathResultBinary(const BasicShortestPathResult<D>& result, const std::filesystem::path& path);
+template <typename D>
+BasicShortestPathResult<D> loadShortestPathResultBinary(const std::filesystem::path& path);
+
+// Minimum spanning tree results, text
+template <typename W>
+void writeMstResult(std::ostream& os, const BasicMinimumSpanningTreeResult<W>& result);
+template <typename W>
+void readMstResult(std::istream& is, BasicMinimumSpanningTreeResult<W>& result);
+template <typename W>
+BasicMinimumSpanningTreeResult<W> parseMstResult(const char* begin, const char* end);
+template <typename W>
+void saveMstResult(const BasicMinimumSpanningTreeResult<W>& result, const std::filesystem::path& path);
+template <typename W>
+BasicMinimumSpanningTreeResult<W> loadMstResult(const std::filesystem::path& path);
+
+// Minimum spanning tree results, binary
+template <typename W>
+void saveMstResultBinary(const BasicMinimumSpanningTreeResult<W>& result, const std::filesystem::path& path);
+template <typename W>
+BasicMinimumSpanningTreeResult<W> loadMstResultBinary(const std::filesystem::path& path);
+
+#define GRAPHS_DECLARE_RESULT_IO(T)                                                                                    \
+    extern template void writeShortestPathResult(std::ostream&, const BasicShortestPathResult<T>&);                   \
+    extern template void readShortestPathResult(std::istream&, BasicShortestPathResult<T>&);                          \
+    extern template BasicShortestPathResult<T> parseShortestPathResult(const char*, const char*);                     \
+    extern template void saveShortestPathResult(const BasicShortestPathResult<T>&, const std::filesystem::path&);     \
+    extern template BasicShortestPathResult<T> loadShortestPathResult(const std::filesystem::path&);                  \
+    extern template void saveShortestPathResultBinary(const BasicShortestPathResult<T>&,                              \
+                                                      const std::filesystem::path&);                                   \
+    extern template BasicShortestPathResult<T> loadShortestPathResultBinary(const std::filesystem::path&);            \
+    extern template void writeMstResult(std::ostream&, const BasicMinimumSpanningTreeResult<T>&);                     \
+    extern template void readMstResult(std::istream&, BasicMinimumSpanningTreeResult<T>&);                            \
+    extern template BasicMinimumSpanningTreeResult<T> parseMstResult(const char*, const char*);                       \
+    extern template void saveMstResult(const BasicMinimumSpanningTreeResult<T>&, const std::filesystem::path&);       \
+    extern template BasicMinimumSpanningTreeResult<T> loadMstResult(const std::filesystem::path&);                    \
+    extern template void saveMstResultBinary(const BasicMinimumSpanningTreeResult<T>&, const std::filesystem::path&); \
+    extern template BasicMinimumSpanningTreeResult<T> loadMstResultBinary(const std::filesystem::path&);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_RESULT_IO)
+#undef GRAPHS_DECLARE_RESULT_IO
+
+#endif /* RESULT_IO_HPP_ */
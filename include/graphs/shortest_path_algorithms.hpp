@@ -1,7 +1,10 @@
 #ifndef SHORTEST_PATH_ALGORITHMS_HPP_
 #define SHORTEST_PATH_ALGORITHMS_HPP_
 
+#include "graphs/csr_graph.hpp"
 #include "graphs/graph.hpp"
+#include "graphs/indexed_heap.hpp"
+#include "graphs/shortest_path_tree.hpp"
 
 #include <map>
 #include <utility>
@@ -10,12 +13,124 @@
 /*
  * Klucz slownika to indeks wierzchołka końcowego
  * Wartość to std::pair, która zawiera:
- *   first - całkowita długość ścieżki
+ *   first - całkowita długość ścieżki (typu D)
  *   second - wektor indeksów wierzchołków ze źródła do wirzechołka końcowego
  */
-using ShortestPathResult = std::map<int, std::pair<int, std::vector<int>>>;
+template <typename D>
+using BasicShortestPathResult = std::map<int, std::pair<D, std::vector<int>>>;
 
-void dijkstra(Graph& graph, int sourceIndex, ShortestPathResult& result);
-bool bellmanFord(Graph& graph, int sourceIndex, ShortestPathResult& result);
+using ShortestPathResult = BasicShortestPathResult<int>;
+
+// Najkrotsza sciezka miedzy para wierzcholkow
+template <typename D>
+struct BasicShortestPath
+{
+    D distance = infiniteDistance<D>();
+    std::vector<int> vertices; // od zrodla do celu, puste, gdy cel jest nieosiagalny
+    int settledVertices = 0;   // liczba wierzcholkow zdjetych z kolejek (koszt zapytania)
+};
+
+using ShortestPath = BasicShortestPath<int>;
+
+// Punkty orientacyjne (landmarks) heurystyki ALT dla zapytan A*: odleglosci z kazdego punktu do wszystkich
+// wierzcholkow i ze wszystkich wierzcholkow do punktu, po gestych indeksach grafu, dla ktorego je policzono.
+// Odleglosci wierzcholka do wszystkich punktow leza obok siebie ([v * k + l]), bo A* czyta je razem.
+template <typename D>
+struct BasicLandmarks
+{
+    std::vector<int> vertices;   // identyfikatory punktow w kolejnosci wyboru (k = vertices.size())
+    int numVertices = 0;         // liczba wierzcholkow grafu
+    std::vector<D> fromLandmark; // [v * k + l] - odleglosc z punktu l do v
+    std::vector<D> toLandmark;   // [v * k + l] - odleglosc z v do punktu l; puste dla grafu nieskierowanego
+};
+
+using Landmarks = BasicLandmarks<int>;
+
+// Liczba dzieci wezla kopca w algorytmie Dijkstry (IndexedHeap), do zmiany przy kompilacji
+#ifndef GRAPHS_DIJKSTRA_HEAP_ARITY
+#define GRAPHS_DIJKSTRA_HEAP_ARITY 4
+#endif
+
+// Najwieksza waga, przy ktorej dijkstra z DijkstraQueue::Automatic uzywa kolejki kubelkowej Diala
+#ifndef GRAPHS_DIAL_MAX_WEIGHT
+#define GRAPHS_DIAL_MAX_WEIGHT 4096
+#endif
+
+// Kolejka priorytetowa algorytmu Dijkstry
+enum class DijkstraQueue
+{
+    Automatic,
+    DaryHeap,
+    BucketQueue,
+    RadixHeap
+};
+
+// Wagi krawedzi sa typu W, odleglosci sumowane sa w typie D (np. wagi uint8_t, odleglosci int64_t).
+// Wersje z BasicShortestPathTree zwracaja zwarte drzewo poprzednikow (O(V) pamieci), wersje ze slownikiem
+// buduja wszystkie sciezki (tree.toMap()). Grafy listowe i macierzowe sa kopiowane do CSR, a CompressedGraph
+// i SuccinctGraph przegladane w miejscu kursorem (tez w shortestPath); pozostale algorytmy ponizej wymagaja CSR
+// i odrzucaja grafy skompresowane (std::invalid_argument, patrz asCsr).
+template <typename W, typename D>
+void dijkstra(BasicGraph<W>& graph, int sourceIndex, BasicShortestPathTree<D>& tree,
+              DijkstraQueue queue = DijkstraQueue::Automatic);
+template <typename W, typename D>
+void dijkstra(BasicGraph<W>& graph, int sourceIndex, BasicShortestPathResult<D>& result,
+              DijkstraQueue queue = DijkstraQueue::Automatic);
+template <typename W, typename D>
+bool bellmanFord(BasicGraph<W>& graph, int sourceIndex, BasicShortestPathTree<D>& tree);
+template <typename W, typename D>
+bool bellmanFord(BasicGraph<W>& graph, int sourceIndex, BasicShortestPathResult<D>& result);
+
+// Zapytania o jedna pare (zrodlo, cel) dla nieujemnych wag; false, gdy cel jest nieosiagalny.
+// shortestPath konczy Dijkstre po zdjeciu celu, bidirectionalShortestPath przeszukuje graf z obu koncow.
+// Kazde wywolanie alokuje tablice O(V) (a graf listowy i macierzowy kopiuje do CSR); dla serii zapytan na jednym grafie
+// sluzy BasicShortestPathQuery.
+template <typename W, typename D>
+bool shortestPath(BasicGraph<W>& graph, int sourceIndex, int targetIndex, BasicShortestPath<D>& path);
+template <typename W, typename D>
+bool bidirectionalShortestPath(BasicGraph<W>& graph, int sourceIndex, int targetIndex, BasicShortestPath<D>& path);
+
+// Wybiera do count punktow orientacyjnych (kazdy kolejny najdalej od juz wybranych, z pominieciem wierzcholkow
+// bez krawedzi) i liczy ich tablice odleglosci. aStarShortestPath to A* z dolnymi ograniczeniami z nierownosci
+// trojkata wzgledem tych punktow; graf nie moze sie zmienic miedzy computeLandmarks a zapytaniami. Wagi musza byc
+// nieujemne. Dla serii zapytan sluzy BasicShortestPathQuery::computeLandmarks i aStarShortestPath.
+template <typename W, typename D>
+void computeLandmarks(BasicGraph<W>& graph, int count, BasicLandmarks<D>& landmarks);
+template <typename W, typename D>
+bool aStarShortestPath(BasicGraph<W>& graph, const BasicLandmarks<D>& landmarks, int sourceIndex, int targetIndex,
+                       BasicShortestPath<D>& path);
+
+// Zapytania o pary (zrodlo, cel) na jednym grafie CSR z tablicami i kopcami alokowanymi raz, przy konstrukcji.
+// Kazde zapytanie przywraca na poczatku tylko wierzcholki, ktorych dotknelo poprzednie, wiec jego koszt zalezy
+// od przeszukanej czesci grafu, a nie od V. Graf musi zyc dluzej niz obiekt i nie moze sie w tym czasie zmienic;
+// obiekt nie jest bezpieczny dla wielu watkow (kazdy watek potrzebuje wlasnego).
+template <typename W, typename D>
+class BasicShortestPathQuery
+{
+    using Heap = IndexedHeap<D, GRAPHS_DIJKSTRA_HEAP_ARITY>;
+
+    const BasicCsrGraph<W>& csr;
+    // Strona 0 - w przod od zrodla (link: poprzednik), strona 1 - wstecz od celu (link: nastepnik)
+    std::vector<D> distance[2];
+    std::vector<int> link[2];
+    Heap queues[2];
+    std::vector<int> touched[2]; // wierzcholki wstawione do kolejki strony od ostatniego reset
+    BasicLandmarks<D> landmarkSet;
+
+    void reset();
+
+  public:
+    explicit BasicShortestPathQuery(const BasicCsrGraph<W>& graph);
+
+    bool shortestPath(int sourceIndex, int targetIndex, BasicShortestPath<D>& path);
+    bool bidirectionalShortestPath(int sourceIndex, int targetIndex, BasicShortestPath<D>& path);
+
+    // Punkty orientacyjne A* sa liczone raz dla grafu obiektu i w nim zapamietane
+    void computeLandmarks(int count);
+    const BasicLandmarks<D>& landmarks() const { return landmarkSet; }
+    bool aStarShortestPath(int sourceIndex, int targetIndex, BasicShortestPath<D>& path);
+};
+
+using ShortestPathQuery = BasicShortestPathQuery<int, int>;
 
 #endif /* SHORTEST_PATH_ALGORITHMS_HPP_ */
@@ -0,0 +1,63 @@
+#ifndef SHORTEST_PATH_TREE_HPP_
+#define SHORTEST_PATH_TREE_HPP_
+
+#include <cstddef>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "graphs/weight_traits.hpp"
+
+/*
+ * Wynik algorytmu najkrotszych sciezek jako drzewo poprzednikow: plaska tablica odleglosci i plaska tablica
+ * poprzednikow po gestych indeksach wierzcholkow (O(V) pamieci, bez alokacji na wierzcholek).
+ * Sciezka do wierzcholka jest odtwarzana dopiero na zadanie (pathTo), a toMap() zamienia drzewo
+ * na slownik BasicShortestPathResult ze wszystkimi sciezkami tam, gdzie jest potrzebny (testy, zapis wyniku).
+ * Wierzcholki sa podawane identyfikatorami z grafu.
+ */
+template <typename D>
+class BasicShortestPathTree
+{
+    std::vector<int> vertexIds;                 // indeks -> identyfikator wierzcholka
+    std::unordered_map<int, int> vertexIndices; // identyfikator -> indeks (puste, gdy identycznosc)
+    std::vector<D> distances;                   // infiniteDistance<D>() dla nieosiagalnych
+    std::vector<int> predecessors;              // indeks poprzednika albo -1 (zrodlo, nieosiagalne)
+    int sourceIndex = -1;
+
+  public:
+    BasicShortestPathTree() = default;
+    BasicShortestPathTree(std::vector<int> vertexIds, int sourceIndex, std::vector<D> distances,
+                          std::vector<int> predecessors);
+
+    int numVertices() const { return static_cast<int>(vertexIds.size()); }
+    int source() const { return vertexIds[sourceIndex]; }
+
+    // Rzuca std::runtime_error dla wierzcholka spoza grafu
+    int indexOf(int v) const;
+    int vertexAt(int index) const { return vertexIds[index]; }
+
+    bool reachable(int v) const { return distances[indexOf(v)] != infiniteDistance<D>(); }
+    // infiniteDistance<D>() dla wierzcholka nieosiagalnego
+    D distanceTo(int v) const { return distances[indexOf(v)]; }
+    // Poprzednik v na najkrotszej sciezce; false dla zrodla i wierzcholkow nieosiagalnych
+    bool predecessor(int v, int& result) const;
+
+    // Wierzcholki sciezki ze zrodla do v (pusta, gdy v jest nieosiagalny)
+    std::vector<int> pathTo(int v) const;
+    std::size_t reachableCount() const;
+
+    // Dostep po gestych indeksach
+    const std::vector<D>& distanceArray() const { return distances; }
+    const std::vector<int>& predecessorArray() const { return predecessors; }
+
+    // Wszystkie sciezki jako slownik: koniec -> (koszt, wierzcholki sciezki); pomija nieosiagalne
+    std::map<int, std::pair<D, std::vector<int>>> toMap() const;
+};
+
+#define GRAPHS_DECLARE_SHORTEST_PATH_TREE(D) extern template class BasicShortestPathTree<D>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_SHORTEST_PATH_TREE)
+#undef GRAPHS_DECLARE_SHORTEST_PATH_TREE
+
+using ShortestPathTree = BasicShortestPathTree<int>;
+
+#endif /* SHORTEST_PATH_TREE_HPP_ */
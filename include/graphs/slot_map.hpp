@@ -0,0 +1,166 @@
+#ifndef SLOT_MAP_HPP_
+#define SLOT_MAP_HPP_
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/*
+ * Kontener slotow z licznikami generacji.
+ * Klucz to nieujemny int: dolne IndexBits bitow to indeks slotu w gestej tablicy,
+ * gorne bity to generacja slotu. Slot zwolniony przez erase trafia na liste wolnych
+ * i przy ponownym uzyciu dostaje kolejna generacje, wiec stary klucz jest wykrywany
+ * jako niewazny. Slot, ktorego generacja sie wyczerpala, nie jest juz uzywany ponownie
+ * (jego pamiec zostaje w tablicy), wiec slot sluzy 2^(31 - IndexBits) razy.
+ * Klucze slotow w pierwszej generacji sa rowne indeksom (0, 1, 2, ...).
+ * Pojemnosc to MAX_SLOTS = 2^IndexBits slotow (np. 2^27 = 134M przy 4 bitach generacji);
+ * wstawienie ponad nia rzuca std::length_error. Wiecej bitow indeksu to mniej ponownych uzyc slotu.
+ */
+template <typename T, int IndexBits = 24>
+class SlotMap
+{
+    static_assert(IndexBits >= 24 && IndexBits <= 30, "SlotMap needs 1..7 generation bits");
+
+  public:
+    static constexpr int GENERATION_BITS = 31 - IndexBits;
+    static constexpr int INDEX_MASK = (1 << IndexBits) - 1;
+    static constexpr int MAX_GENERATION = (1 << GENERATION_BITS) - 1;
+    static constexpr int MAX_SLOTS = INDEX_MASK + 1;
+
+  private:
+    static constexpr std::uint8_t ALIVE = 0x80;
+
+    std::vector<T> values;
+    std::vector<std::uint8_t> states; // bit 7 - slot zajety, bity 0..6 - generacja
+    std::vector<int> freeSlots;
+    int count = 0;
+
+    static int generationOf(std::uint8_t state) { return state & ~ALIVE; }
+
+    void checkCapacity() const
+    {
+        if(static_cast<int>(values.size()) > INDEX_MASK)
+        {
+            throw std::length_error("SlotMap is full: at most " + std::to_string(MAX_SLOTS) + " slots");
+        }
+    }
+
+  public:
+    static int indexOf(int key) { return key & INDEX_MASK; }
+
+    // Złożoność czasowa: O(1) zamortyzowana
+    int insert(const T& value)
+    {
+        int index;
+        if(!freeSlots.empty())
+        {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+            values[index] = value;
+        }
+        else
+        {
+            checkCapacity();
+            index = static_cast<int>(values.size());
+            values.push_back(value);
+            states.push_back(0);
+        }
+        states[index] |= ALIVE;
+        ++count;
+        return keyAt(index);
+    }
+
+    // Wstawia wartosc zawsze do nowego slotu na koncu, z pominieciem listy wolnych slotow.
+    // Kolejne wywolania daja wiec kolejne klucze (rowne indeksom), co pozwala wstawiac hurtowo.
+    // Złożoność czasowa: O(1) zamortyzowana
+    int append(const T& value)
+    {
+        checkCapacity();
+        int index = static_cast<int>(values.size());
+        values.push_back(value);
+        states.push_back(ALIVE);
+        ++count;
+        return index;
+    }
+
+    // Złożoność czasowa: O(1)
+    void erase(int key)
+    {
+        if(!contains(key))
+            throw std::out_of_range("Stale or invalid key");
+
+        int index = indexOf(key);
+        int generation = generationOf(states[index]);
+        --count;
+        if(generation == MAX_GENERATION)
+        {
+            states[index] = static_cast<std::uint8_t>(generation);
+            return;
+        }
+        states[index] = static_cast<std::uint8_t>(generation + 1);
+        freeSlots.push_back(index);
+    }
+
+    // Sprawdzenie zakresu, bitu zajetosci i generacji klucza.
+    // Złożoność czasowa: O(1)
+    bool contains(int key) const
+    {
+        if(key < 0)
+            return false;
+
+        int index = indexOf(key);
+        return index < static_cast<int>(states.size()) && states[index] == (ALIVE | (key >> IndexBits));
+    }
+
+    T* find(int key) { return contains(key) ? &values[indexOf(key)] : nullptr; }
+    const T* find(int key) const { return contains(key) ? &values[indexOf(key)] : nullptr; }
+
+    T& at(int key)
+    {
+        if(!contains(key))
+            throw std::out_of_range("Stale or invalid key");
+        return values[indexOf(key)];
+    }
+
+    const T& at(int key) const
+    {
+        if(!contains(key))
+            throw std::out_of_range("Stale or invalid key");
+        return values[indexOf(key)];
+    }
+
+    // Dostep po indeksie slotu, bez sprawdzania generacji
+    bool isAlive(int index) const { return (states[index] & ALIVE) != 0; }
+    int keyAt(int index) const { return (generationOf(states[index]) << IndexBits) | index; }
+    T& valueAt(int index) { return values[index]; }
+    const T& valueAt(int index) const { return values[index]; }
+
+    int size() const { return count; }
+    int slotCount() const { return static_cast<int>(values.size()); }
+
+    // Rzuca std::length_error, gdy n przekracza pojemnosc, zanim wstawianie hurtowe cokolwiek zmieni
+    void reserve(int n)
+    {
+        if(n < 0 || n > MAX_SLOTS)
+        {
+            throw std::length_error("SlotMap is full: at most " + std::to_string(MAX_SLOTS) + " slots");
+        }
+        values.reserve(n);
+        states.reserve(n);
+    }
+
+    // Wywoluje f(klucz, wartosc) dla zajetych slotow w kolejnosci indeksow.
+    // Złożoność czasowa: O(liczba slotow)
+    template <typename F>
+    void forEach(F&& f) const
+    {
+        for(int index = 0; index < slotCount(); ++index)
+        {
+            if(isAlive(index))
+                f(keyAt(index), values[index]);
+        }
+    }
+};
+
+#endif /* SLOT_MAP_HPP_ */
@@ -0,0 +1,31 @@
+#ifndef SPAN_HPP_
+#define SPAN_HPP_
+
+#include <cstddef>
+#include <vector>
+
+// Widok na ciagly fragment tablicy (odpowiednik std::span z C++20), nie posiada danych
+template <typename T>
+class Span
+{
+    T* first = nullptr;
+    std::size_t count = 0;
+
+  public:
+    Span() = default;
+    Span(T* data, std::size_t size) : first(data), count(size) {}
+
+    template <typename U>
+    Span(const std::vector<U>& v) : first(v.data()), count(v.size())
+    {
+    }
+
+    T* data() const { return first; }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    T& operator[](std::size_t i) const { return first[i]; }
+    T* begin() const { return first; }
+    T* end() const { return first + count; }
+};
+
+#endif /* SPAN_HPP_ */
@@ -0,0 +1,113 @@
+#ifndef SUCCINCT_GRAPH_HPP_
+#define SUCCINCT_GRAPH_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "graphs/elias_fano.hpp"
+#include "graphs/read_only_graph.hpp"
+
+/*
+ * Zwiezla (succinct), niezmienna reprezentacja grafu skierowanego z dostepem swobodnym do krawedzi.
+ * Krawedz e z u do v ma klucz u * V + v; klucze w kolejnosci identyfikatorow krawedzi (poczatek, koniec,
+ * kolejnosc wstawienia) tworza jeden niemalejacy ciag zapisany kodem Eliasa-Fano, tak samo jak poczatki
+ * zakresow krawedzi wierzcholkow (offsets). Dla gestosci d graf zajmuje ok. 2 + log2(1 / d) bitow na krawedz,
+ * blisko entropii zbioru krawedzi, a:
+ *   areAdjacent(u, v) to jedno wyszukiwanie nastepnika klucza u * V + v,
+ *   k-ty sasiad i koniec krawedzi to jeden dostep do ciagu kluczy,
+ *   poczatek krawedzi to wyszukiwanie nastepnika w offsets.
+ * Wagi leza w osobnej tablicy upakowanej na bajty (PackedWeights), a identyfikatory, budowa i iteracja sa
+ * wspolne z CompressedGraph (BasicReadOnlyGraph). Indeks odwrotny to drugi ciag Eliasa-Fano posortowanych
+ * kluczy koniec * V + poczatek (tyle samo bitow na krawedz): krawedzie wchodzace do v to jego zakres od klucza
+ * v * V, a identyfikator kazdej z nich - wyszukiwanie nastepnika klucza (poczatek, v) w ciagu kluczy krawedzi.
+ */
+template <typename W>
+class BasicSuccinctGraph : public BasicReadOnlyGraph<BasicSuccinctGraph<W>, W>
+{
+    using Base = BasicReadOnlyGraph<BasicSuccinctGraph<W>, W>;
+    friend Base;
+
+    EliasFano edgeOffsets; // pierwszy identyfikator krawedzi wierzcholka, n + 1
+    EliasFano edgeKeys;    // poczatek * n + koniec, w kolejnosci identyfikatorow
+    EliasFano inKeys;      // koniec * n + poczatek, rosnaco
+
+    static constexpr const char* typeName = "SuccinctGraph";
+    static constexpr const char* printTitle = "ZWIEZLA";
+
+    static std::unique_ptr<BasicSuccinctGraph> build(std::vector<int> ids, const std::vector<int>& sources,
+                                                     const std::vector<int>& targets, const std::vector<W>& weights);
+
+    int sourceIndex(int e) const;
+    int targetIndex(int e) const { return target(e); }
+    std::uint64_t key(int u, int v) const { return static_cast<std::uint64_t>(u) * this->vertexCount + v; }
+
+  public:
+    // Dekoduje nastepniki jednego wierzcholka w kolejnosci rosnacej:
+    // for(auto cursor = graph.neighbors(u); cursor.next();) { cursor.target(); cursor.edge(); }
+    class NeighborCursor
+    {
+        EliasFano::Cursor keys;
+        std::uint64_t base; // klucz pierwszego mozliwego nastepnika
+        int current = -1;
+        int edgeId;
+        int edgeEnd;
+
+      public:
+        NeighborCursor(const EliasFano& edgeKeys, std::uint64_t base, int firstEdge, int edgeEnd)
+            : keys(edgeKeys.cursor(firstEdge)), base(base), edgeId(firstEdge - 1), edgeEnd(edgeEnd)
+        {
+        }
+
+        // Przechodzi do nastepnego sasiada; false, gdy sasiadow juz nie ma
+        bool next()
+        {
+            if(++edgeId == edgeEnd)
+                return false;
+            current = static_cast<int>(keys.next() - base);
+            return true;
+        }
+
+        int target() const { return current; } // indeks nastepnika
+        int edge() const { return edgeId; }
+    };
+
+    // Iteration methods
+    std::vector<int> inEdges(int v) const override;
+
+    // Access methods
+    bool areAdjacent(int v1, int v2) const override;
+
+    // Non-allocating access methods
+    void forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const override;
+
+    // Dostep po gestych indeksach wierzcholkow
+    int firstEdge(int index) const { return static_cast<int>(edgeOffsets[index]); }
+    int outDegree(int index) const { return firstEdge(index + 1) - firstEdge(index); }
+
+    // Indeks k-tego (od 0, rosnaco) nastepnika; k < outDegree(index)
+    int neighbor(int index, int k) const { return static_cast<int>(edgeKeys[firstEdge(index) + k] - key(index, 0)); }
+
+    // Indeks konca krawedzi o identyfikatorze e, bez sprawdzania zakresu
+    int target(int e) const
+    {
+        return static_cast<int>(edgeKeys[e] % static_cast<std::uint64_t>(this->vertexCount));
+    }
+
+    NeighborCursor neighbors(int index) const
+    {
+        return {edgeKeys, key(index, 0), firstEdge(index), firstEdge(index + 1)};
+    }
+
+    // Pamiec zajmowana przez tablice grafu w bajtach
+    std::size_t memoryUsage() const;
+};
+
+#define GRAPHS_DECLARE_SUCCINCT_GRAPH(W)                                                                               \
+    extern template class BasicReadOnlyGraph<BasicSuccinctGraph<W>, W>;                                                \
+    extern template class BasicSuccinctGraph<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_DECLARE_SUCCINCT_GRAPH)
+#undef GRAPHS_DECLARE_SUCCINCT_GRAPH
+
+using SuccinctGraph = BasicSuccinctGraph<int>;
+
+#endif /* SUCCINCT_GRAPH_HPP_ */
@@ -0,0 +1,105 @@
+#ifndef TEXT_CURSOR_HPP_
+#define TEXT_CURSOR_HPP_
+
+#include <charconv>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include "graphs/edge_list.hpp"
+
+// Czytnik liczb z bufora tekstowego (std::from_chars) z numerem biezacej linii do komunikatow ParseError.
+// Wspolny dla loadEdgeList i strumieni krawedzi.
+class TextCursor
+{
+    const char* pos;
+    const char* end;
+    int lineNumber = 1;
+
+    static bool isSpace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t'; }
+    static bool isBlank(char c) { return c == ' ' || c == '\r' || c == '\t'; }
+
+    void skipSpace()
+    {
+        for(; pos != end && isSpace(*pos); ++pos)
+        {
+            if(*pos == '\n')
+                ++lineNumber;
+        }
+    }
+
+  public:
+    TextCursor(const char* begin, const char* end) : pos(begin), end(end) {}
+
+    int line() const { return lineNumber; }
+    const char* position() const { return pos; }
+
+    bool atEnd()
+    {
+        skipSpace();
+        return pos == end;
+    }
+
+    // Pierwszy znak nastepnego pola; wymaga !atEnd()
+    char peek()
+    {
+        skipSpace();
+        return *pos;
+    }
+
+    // Czy w biezacej linii nie ma juz pol
+    bool atLineEnd()
+    {
+        while(pos != end && isBlank(*pos))
+            ++pos;
+        return pos == end || *pos == '\n';
+    }
+
+    // Pomija reszte biezacej linii (znak nowej linii liczy nastepny skipSpace)
+    void skipLine()
+    {
+        const char* newline = static_cast<const char*>(std::memchr(pos, '\n', end - pos));
+        pos = newline == nullptr ? end : newline;
+    }
+
+    // Czyta pole tekstowe (do najblizszego bialego znaku)
+    std::string_view readWord(const char* what)
+    {
+        skipSpace();
+        if(pos == end)
+            throw ParseError(lineNumber, std::string("unexpected end of file, expected ") + what);
+
+        const char* first = pos;
+        while(pos != end && !isSpace(*pos))
+            ++pos;
+        return {first, static_cast<std::size_t>(pos - first)};
+    }
+
+    // Czyta jedna liczbe typu T; what opisuje oczekiwane pole w komunikacie bledu
+    template <typename T>
+    T read(const char* what)
+    {
+        skipSpace();
+        if(pos == end)
+            throw ParseError(lineNumber, std::string("unexpected end of file, expected ") + what);
+
+        T value{};
+        auto [next, ec] = std::from_chars(pos, end, value);
+        if(ec == std::errc::result_out_of_range)
+            throw ParseError(lineNumber, std::string(what) + " out of range");
+        if(ec != std::errc() || (next != end && !isSpace(*next)))
+            throw ParseError(lineNumber, std::string("invalid ") + what);
+
+        pos = next;
+        return value;
+    }
+
+    int readVertex(int vertexCount, const char* what)
+    {
+        int v = read<int>(what);
+        if(v < 0 || v >= vertexCount)
+            throw ParseError(lineNumber, std::string(what) + " " + std::to_string(v) + " does not exist");
+        return v;
+    }
+};
+
+#endif /* TEXT_CURSOR_HPP_ */
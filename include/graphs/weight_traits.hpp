@@ -0,0 +1,83 @@
+#ifndef WEIGHT_TRAITS_HPP_
+#define WEIGHT_TRAITS_HPP_
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+// Typy wag, dla ktorych biblioteka jawnie instancjonuje grafy
+#define GRAPHS_FOR_EACH_WEIGHT(X)                                                                                      \
+    X(std::int8_t)                                                                                                     \
+    X(std::uint8_t)                                                                                                    \
+    X(std::int16_t)                                                                                                    \
+    X(int)                                                                                                             \
+    X(std::int64_t)                                                                                                    \
+    X(float)                                                                                                           \
+    X(double)
+
+// Pary (waga, odleglosc), dla ktorych jawnie instancjonowane sa algorytmy najkrotszych sciezek
+#define GRAPHS_FOR_EACH_WEIGHT_AND_DISTANCE(X)                                                                         \
+    X(std::int8_t, int)                                                                                                \
+    X(std::int8_t, std::int64_t)                                                                                       \
+    X(std::uint8_t, int)                                                                                               \
+    X(std::uint8_t, std::int64_t)                                                                                      \
+    X(std::int16_t, int)                                                                                               \
+    X(std::int16_t, std::int64_t)                                                                                      \
+    X(int, int)                                                                                                        \
+    X(int, std::int64_t)                                                                                               \
+    X(std::int64_t, std::int64_t)                                                                                      \
+    X(float, float)                                                                                                    \
+    X(float, double)                                                                                                   \
+    X(double, double)
+
+// Wczytuje wage typu W ze strumienia. Wagi calkowite sa czytane jako liczby (a nie znaki,
+// jak dla int8_t / uint8_t); wartosc spoza zakresu W ustawia failbit.
+template <typename W>
+W readWeight(std::istream& is)
+{
+    if constexpr(std::is_floating_point_v<W>)
+    {
+        W weight{};
+        is >> weight;
+        return weight;
+    }
+    else
+    {
+        long long value = 0;
+        is >> value;
+        if(value < static_cast<long long>(std::numeric_limits<W>::min()) ||
+           value > static_cast<long long>(std::numeric_limits<W>::max()))
+        {
+            is.setstate(std::ios::failbit);
+        }
+        return static_cast<W>(value);
+    }
+}
+
+// Wartosc do wypisania: int8_t / uint8_t jako liczba, a nie znak
+template <typename W>
+auto printableWeight(W weight)
+{
+    return +weight;
+}
+
+// "Nieskonczona" odleglosc dla typu D
+template <typename D>
+constexpr D infiniteDistance()
+{
+    if constexpr(std::numeric_limits<D>::has_infinity)
+        return std::numeric_limits<D>::infinity();
+    else
+        return std::numeric_limits<D>::max();
+}
+
+// Kod typu wagi w plikach binarnych: rozmiar w bajtach, bit 8 - typ zmiennoprzecinkowy, bit 9 - typ ze znakiem
+template <typename W>
+constexpr std::uint32_t weightTypeCode()
+{
+    return static_cast<std::uint32_t>(sizeof(W)) | (std::is_floating_point_v<W> ? 0x100u : 0u) |
+           (std::is_signed_v<W> ? 0x200u : 0u);
+}
+
+#endif /* WEIGHT_TRAITS_HPP_ */
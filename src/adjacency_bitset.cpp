@@ -0,0 +1,189 @@
+#include "graphs/adjacency_bitset.hpp"
+#include <algorithm>
+#include "graphs/bit_ops.hpp"
+
+// Sciezka AVX2 na x64, wybierana w czasie dzialania; kompilator nie musi miec wlaczonego AVX2
+// (gcc / clang kompiluja ja z atrybutem target, MSVC udostepnia intrinsics bez /arch).
+#if defined(_M_X64) || defined(__x86_64__)
+#define GRAPHS_BITSET_AVX2 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define GRAPHS_TARGET_AVX2
+#else
+#define GRAPHS_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#endif
+#endif
+
+namespace
+{
+// Operacja na parze slow wierszy przed policzeniem bitow
+enum class WordOp
+{
+    First,
+    And,
+    Or
+};
+
+template <WordOp Op>
+std::uint64_t combine(std::uint64_t a, std::uint64_t b)
+{
+    if constexpr(Op == WordOp::And)
+        return a & b;
+    else if constexpr(Op == WordOp::Or)
+        return a | b;
+    else
+        return a;
+}
+
+// Suma popcount(op(a[i], b[i])) po n slowach, rozwinieta na 4 niezalezne akumulatory, zeby kolejne
+// popcount nie czekaly na jeden licznik.
+template <WordOp Op>
+int countWordsScalar(const std::uint64_t* a, const std::uint64_t* b, int n)
+{
+    int c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    int i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        c0 += popcount(combine<Op>(a[i], b[i]));
+        c1 += popcount(combine<Op>(a[i + 1], b[i + 1]));
+        c2 += popcount(combine<Op>(a[i + 2], b[i + 2]));
+        c3 += popcount(combine<Op>(a[i + 3], b[i + 3]));
+    }
+    for(; i < n; ++i)
+    {
+        c0 += popcount(combine<Op>(a[i], b[i]));
+    }
+    return c0 + c1 + c2 + c3;
+}
+
+#if GRAPHS_BITSET_AVX2
+bool cpuHasAvx2()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if(info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    // System musi zapisywac rejestry YMM przy przelaczaniu kontekstu (OSXSAVE i XCR0)
+    bool ymmEnabled = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6;
+    bool popcnt = (info[2] & (1 << 23)) != 0;
+    __cpuidex(info, 7, 0);
+    return ymmEnabled && popcnt && (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+#endif
+}
+
+// popcount 4 slow naraz: liczby bitow polowek bajtow z tablicy (vpshufb), sumy bajtow przez vpsadbw
+// do czterech 64-bitowych licznikow; koncowka wiersza przez popcnt.
+template <WordOp Op>
+GRAPHS_TARGET_AVX2 int countWordsAvx2(const std::uint64_t* a, const std::uint64_t* b, int n)
+{
+    const __m256i nibbleCounts = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibbles = _mm256_set1_epi8(0x0f);
+    __m256i total = _mm256_setzero_si256();
+    int i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        if constexpr(Op != WordOp::First)
+        {
+            __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            x = Op == WordOp::And ? _mm256_and_si256(x, y) : _mm256_or_si256(x, y);
+        }
+        __m256i low = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(x, lowNibbles));
+        __m256i high = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(_mm256_srli_epi16(x, 4), lowNibbles));
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+    }
+
+    alignas(32) std::uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), total);
+    std::uint64_t count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for(; i < n; ++i)
+    {
+        count += _mm_popcnt_u64(combine<Op>(a[i], b[i]));
+    }
+    return static_cast<int>(count);
+}
+#endif
+
+template <WordOp Op>
+int countWords(const std::uint64_t* a, const std::uint64_t* b, int n)
+{
+#if GRAPHS_BITSET_AVX2
+    static const bool avx2 = cpuHasAvx2();
+    if(avx2)
+        return countWordsAvx2<Op>(a, b, n);
+#endif
+    return countWordsScalar<Op>(a, b, n);
+}
+} // namespace
+
+// Przepisuje wiersze do nowego bufora, gdy brakuje wierszy lub slow w wierszu.
+// Złożoność czasowa: O(V^2 / 64) zamortyzowana, pamięciowa: O(V^2 / 8) bajtow
+void AdjacencyBitset::resize(int vertexCount)
+{
+    if(vertexCount <= rowCount)
+        return;
+
+    int newRows = std::max(vertexCount, rowCount * 2);
+    int newWordsPerRow = (newRows + 63) / 64;
+
+    std::vector<std::uint64_t> grown(static_cast<std::size_t>(newRows) * newWordsPerRow, 0);
+    for(int u = 0; u < rowCount; ++u)
+    {
+        std::copy_n(row(u), wordsPerRow, grown.begin() + static_cast<std::size_t>(u) * newWordsPerRow);
+    }
+    words.swap(grown);
+    rowCount = newRows;
+    wordsPerRow = newWordsPerRow;
+}
+
+// Złożoność czasowa: O(V)
+void AdjacencyBitset::clearVertex(int u)
+{
+    std::fill_n(row(u), wordsPerRow, 0);
+    for(int v = 0; v < rowCount; ++v)
+    {
+        reset(v, u);
+    }
+}
+
+// Złożoność czasowa: O(V / 64)
+int AdjacencyBitset::degree(int u) const
+{
+    return countWords<WordOp::First>(row(u), row(u), wordsPerRow);
+}
+
+// Liczba wspolnych nastepnikow u i v.
+// Złożoność czasowa: O(V / 64)
+int AdjacencyBitset::intersectionCount(int u, int v) const
+{
+    return countWords<WordOp::And>(row(u), row(v), wordsPerRow);
+}
+
+// Liczba wierzcholkow bedacych nastepnikiem u lub v.
+// Złożoność czasowa: O(V / 64)
+int AdjacencyBitset::unionCount(int u, int v) const
+{
+    return countWords<WordOp::Or>(row(u), row(v), wordsPerRow);
+}
+
+// Lista wspolnych nastepnikow u i v (indeksy rosnaco).
+// Złożoność czasowa: O(V / 64 + wynik)
+std::vector<int> AdjacencyBitset::intersection(int u, int v) const
+{
+    std::vector<int> result;
+    const std::uint64_t* a = row(u);
+    const std::uint64_t* b = row(v);
+    for(int i = 0; i < wordsPerRow; ++i)
+    {
+        for(std::uint64_t word = a[i] & b[i]; word != 0; word &= word - 1)
+        {
+            result.push_back(i * 64 + countTrailingZeros(word));
+        }
+    }
+    return result;
+}
@@ -4,95 +4,209 @@
 
 //metody uaktualniajce
 //  Dodaje nowy wierzchołek o wartości val (domyślnie 0).
-//  Tworzy nowy identyfikator, dodaje do mapy vertices i tworzy pustą listę sąsiedztwa.
-//  Złożoność czasowa: O(1), pamięciowa: O(1)
-int AdjacencyListGraph::insertVertex(int val = 0)
+//  Zajmuje slot w vertices (wolny albo nowy) i czyści albo dodaje listy krawędzi wychodzących i wchodzących.
+//  Złożoność czasowa: O(1) zamortyzowana, pamięciowa: O(1)
+template <typename W>
+int BasicAdjacencyListGraph<W>::insertVertex(int val)
 {
-    int id = nextVertexId++;
-    vertices[id] = val;
-    adjacencyList[id] = {};
+    int id = vertices.insert(val);
+    std::size_t index = VertexMap::indexOf(id);
+    if(index == adjacencyList.size())
+    {
+        adjacencyList.emplace_back();
+        incomingList.emplace_back();
+    }
+    if(adjacencyBitset)
+        adjacencyBitset->resize(static_cast<int>(index) + 1);
     return id;
 }
 
+// Ustawia bit pary (v1, v2), a w grafie nieskierowanym również (v2, v1).
+template <typename W>
+void BasicAdjacencyListGraph<W>::setAdjacencyBits(int v1, int v2)
+{
+    adjacencyBitset->set(VertexMap::indexOf(v1), VertexMap::indexOf(v2));
+    if(!directed)
+        adjacencyBitset->set(VertexMap::indexOf(v2), VertexMap::indexOf(v1));
+}
+
 // Dodaje nową krawędź między v1 i v2 o wadze weight.
-// Sprawdza istnienie wierzchołków, tworzy nowy identyfikator krawędzi, dodaje do mapy edges
-// i do listy sąsiedztwa v1.
+// Sprawdza istnienie wierzchołków, tworzy nowy identyfikator krawędzi, dodaje do mapy edges,
+// do listy krawędzi wychodzących v1 i do listy krawędzi wchodzących v2
+// (w grafie nieskierowanym do list incydencji v1 i v2, pętla własna raz).
 // Złożoność czasowa: O(1), pamięciowa: O(1)
-int AdjacencyListGraph::insertEdge(int v1, int v2, int weight)
+template <typename W>
+int BasicAdjacencyListGraph<W>::insertEdge(int v1, int v2, W weight)
 {
-    if(vertices.find(v1) == vertices.end() || vertices.find(v2) == vertices.end())
+    if(!vertices.contains(v1) || !vertices.contains(v2))
     {
         throw std::runtime_error("Vertex does not exist");
     }
 
-    int edgeId = nextEdgeId++;
-    edges[edgeId] = {v1, v2, weight};
-    adjacencyList[v1].push_back(edgeId);
+    int edgeId = edges.insert({v1, v2, weight});
+    adjacencyList[VertexMap::indexOf(v1)].push_back(edgeId);
+    if(directed || v1 != v2)
+        endLists()[VertexMap::indexOf(v2)].push_back(edgeId);
+    if(adjacencyBitset)
+        setAdjacencyBits(v1, v2);
     return edgeId;
 }
 
+// Dodaje n wierzchołków o wartości 0 w nowych slotach (wolne sloty nie są używane),
+// więc identyfikatory są kolejne: first, first + 1, ..., first + n - 1.
+// Złożoność czasowa: O(n), pamięciowa: O(n)
+template <typename W>
+int BasicAdjacencyListGraph<W>::insertVertices(int n)
+{
+    if(n < 0)
+    {
+        throw std::invalid_argument("Negative vertex count");
+    }
+
+    int first = vertices.slotCount();
+    vertices.reserve(first + n);
+    adjacencyList.resize(first + n);
+    incomingList.resize(first + n);
+    for(int i = 0; i < n; ++i)
+    {
+        vertices.append(0);
+    }
+    if(adjacencyBitset)
+        adjacencyBitset->resize(first + n);
+    return first;
+}
+
+// Dodaje wszystkie krawędzie z input.
+// Najpierw sprawdza końce wszystkich krawędzi i liczy stopnie, potem rezerwuje miejsce
+// w mapie edges i w listach wychodzących / wchodzących, więc żadna lista nie jest przepisywana
+// więcej niż raz. Identyfikatory krawędzi są kolejne, w kolejności input.
+// Złożoność czasowa: O(V + m), pamięciowa: O(V)
+template <typename W>
+int BasicAdjacencyListGraph<W>::insertEdges(Span<const typename BasicGraph<W>::EdgeInput> input)
+{
+    std::vector<int> outCount(adjacencyList.size(), 0), inCount(incomingList.size(), 0);
+    for(const auto& edge : input)
+    {
+        if(!vertices.contains(edge.v1) || !vertices.contains(edge.v2))
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        ++outCount[VertexMap::indexOf(edge.v1)];
+        if(directed)
+            ++inCount[VertexMap::indexOf(edge.v2)];
+        else if(edge.v1 != edge.v2)
+            ++outCount[VertexMap::indexOf(edge.v2)];
+    }
+
+    for(std::size_t index = 0; index < adjacencyList.size(); ++index)
+    {
+        if(outCount[index] > 0)
+            adjacencyList[index].reserve(adjacencyList[index].size() + outCount[index]);
+        if(inCount[index] > 0)
+            incomingList[index].reserve(incomingList[index].size() + inCount[index]);
+    }
+
+    int first = edges.slotCount();
+    edges.reserve(first + static_cast<int>(input.size()));
+    for(const auto& edge : input)
+    {
+        int edgeId = edges.append({edge.v1, edge.v2, edge.weight});
+        adjacencyList[VertexMap::indexOf(edge.v1)].push_back(edgeId);
+        if(directed || edge.v1 != edge.v2)
+            endLists()[VertexMap::indexOf(edge.v2)].push_back(edgeId);
+        if(adjacencyBitset)
+            setAdjacencyBits(edge.v1, edge.v2);
+    }
+    return first;
+}
+
 
 
 // Usuwa wierzchołek v oraz wszystkie incydentne krawędzie.
-// Najpierw znajduje wszystkie krawędzie incydentne do v (przeglądając całą mapę edges),
-// następnie usuwa je z mapy edges oraz z list sąsiedztwa sąsiadów.
-// Na końcu usuwa v z mapy vertices i adjacencyList.
-// Złożoność czasowa: O(E), gdzie E to liczba krawędzi (przeglądanie wszystkich krawędzi).
+// Krawędzie incydentne bierze z list krawędzi wychodzących i wchodzących v, usuwa je z mapy edges
+// oraz z list drugiego końca (wchodzących u celu, wychodzących u źródła).
+// W grafie nieskierowanym wszystkie incydentne krawędzie są w liście wychodzących v.
+// Na końcu usuwa v z mapy vertices i z obu list.
+// Złożoność czasowa: O(sum(d_u)), gdzie d_u to stopnie sąsiadów v (usuwanie z ich wektorów).
 // Pamięciowa: O(1)
-void AdjacencyListGraph::removeVertex(int v)
+template <typename W>
+void BasicAdjacencyListGraph<W>::removeVertex(int v)
 {
-    if(v>= nextVertexId)
+    if(!vertices.contains(v))
     {
         throw std::out_of_range("Vertex does not exist");
     }
 
-    std::vector<int> edgesToRemove;
+    auto removeFromList = [](auto& list, int vertex, int edgeToRemove) {
+        auto& edgeIds = list[VertexMap::indexOf(vertex)];
+        edgeIds.erase(std::remove(edgeIds.begin(), edgeIds.end(), edgeToRemove), edgeIds.end());
+    };
 
-    edgesToRemove = incidentEdges(v);
+    auto& out = adjacencyList[VertexMap::indexOf(v)];
+    auto& in = incomingList[VertexMap::indexOf(v)];
 
-    for(int edgeId : edgesToRemove)
+    for(int edgeId : out)
     {
         const Edge& edge = edges.at(edgeId);
+        int other = edge.v1 == v ? edge.v2 : edge.v1;
+        if(other != v)
+            removeFromList(endLists(), other, edgeId);
+        edges.erase(edgeId);
+    }
 
-        int neighbor = (edge.v1 == v) ? edge.v2 : edge.v1;
-
-        if(adjacencyList.find(neighbor) != adjacencyList.end())
-        {
-            auto& neighborEdges = adjacencyList.at(neighbor);
-            neighborEdges.erase(std::remove(neighborEdges.begin(), neighborEdges.end(), edgeId), neighborEdges.end());
-        }
+    for(int edgeId : in)
+    {
+        const Edge* edge = edges.find(edgeId);
+        if(edge == nullptr)
+            continue; // petla wlasna, usunieta juz wyzej
 
+        removeFromList(adjacencyList, edge->v1, edgeId);
         edges.erase(edgeId);
     }
 
     vertices.erase(v);
-    adjacencyList.erase(v);
+    out.clear();
+    in.clear();
+    if(adjacencyBitset)
+        adjacencyBitset->clearVertex(VertexMap::indexOf(v));
 }
 
 // Usuwa krawędź o identyfikatorze e.
-// Sprawdza istnienie krawędzi, usuwa ją z mapy edges oraz z list sąsiedztwa obu końców krawędzi.
+// Sprawdza istnienie krawędzi, usuwa ją z mapy edges, z listy wychodzących v1 i z listy wchodzących v2.
 // Złożoność czasowa: O(d1 + d2), gdzie d1 i d2 to stopnie końców krawędzi (usuwanie z wektorów).
 // Pamięciowa: O(1)
-void AdjacencyListGraph::removeEdge(int e)
+template <typename W>
+void BasicAdjacencyListGraph<W>::removeEdge(int e)
 {
 
-    if (edges.find(e) == edges.end())
+    if (!edges.contains(e))
     {
         throw std::runtime_error("Edge does not exist");
     }
 
-    const Edge& edge = edges.find(e)->second;
+    const Edge& edge = edges.at(e);
     int v1 = edge.v1;
     int v2 = edge.v2;
 
     auto removeFromAdjList = [](auto& adjList, int vertex, int edgeToRemove) { 
-        auto& edges = adjList.at(vertex);
+        auto& edges = adjList[VertexMap::indexOf(vertex)];
         edges.erase(std::remove(edges.begin(), edges.end(), edgeToRemove), edges.end());
         };
     removeFromAdjList(adjacencyList, v1, e);
-    removeFromAdjList(adjacencyList, v2, e);
+    removeFromAdjList(endLists(), v2, e);
     edges.erase(e);
 
+    // Bit zostaje, jesli miedzy v1 i v2 jest jeszcze inna (rownolegla) krawedz
+    if(adjacencyBitset && !std::any_of(outList(v1).begin(), outList(v1).end(), [this, v1, v2](int edgeId) {
+           const Edge& edge = edges.at(edgeId);
+           return (edge.v1 == v1 ? edge.v2 : edge.v1) == v2;
+       }))
+    {
+        adjacencyBitset->reset(VertexMap::indexOf(v1), VertexMap::indexOf(v2));
+        if(!directed)
+            adjacencyBitset->reset(VertexMap::indexOf(v2), VertexMap::indexOf(v1));
+    }
+
 
 }
 
@@ -100,54 +214,86 @@ void AdjacencyListGraph::removeEdge(int e)
 // metody iterujace
 
 // Zwraca wektor identyfikatorów wszystkich wierzchołków w grafie.
-// Przechodzi po mapie vertices i zbiera klucze.
+// Przechodzi po slotach vertices i zbiera klucze zajętych.
 // Złożoność czasowa: O(V), pamięciowa: O(V)
-std::vector<int> AdjacencyListGraph::showVertices() const
+template <typename W>
+std::vector<int> BasicAdjacencyListGraph<W>::showVertices() const
 {
     std::vector<int> result;
-    for(const auto& [id, val] : vertices) 
-    {
-        result.push_back(id); 
-    }
+    result.reserve(vertices.size());
+    vertices.forEach([&result](int id, int) { result.push_back(id); });
     return result;
 }
 
 // Zwraca wektor identyfikatorów wszystkich krawędzi w grafie.
-// Przechodzi po mapie edges i zbiera klucze.
+// Przechodzi po slotach edges i zbiera klucze zajętych.
 // Złożoność czasowa: O(E), pamięciowa: O(E)
-std::vector<int> AdjacencyListGraph::showEdges() const
+template <typename W>
+std::vector<int> BasicAdjacencyListGraph<W>::showEdges() const
 {
     std::vector<int> result;
-    for(const auto& [id, _] : edges)
-    {
-        result.push_back(id);
-    }
+    result.reserve(edges.size());
+    edges.forEach([&result](int id, const Edge&) { result.push_back(id); });
     return result;
 }
 
 
-// Zwraca wektor identyfikatorów krawędzi incydentnych do wierzchołka v.
-// Przechodzi po wszystkich krawędziach i sprawdza, czy v jest końcem krawędzi.
-// Złożoność czasowa: O(E), pamięciowa: O(d), gdzie d to liczba incydentnych krawędzi.
+// Zwraca wektor identyfikatorów krawędzi incydentnych do wierzchołka v:
+// najpierw wychodzące, potem wchodzące (pętla własna pojawia się raz).
+// W grafie nieskierowanym to po prostu lista incydencji v.
+// Złożoność czasowa: O(d), pamięciowa: O(d), gdzie d to liczba incydentnych krawędzi.
 
-std::vector<int> AdjacencyListGraph::incidentEdges(int v) const
+template <typename W>
+std::vector<int> BasicAdjacencyListGraph<W>::incidentEdges(int v) const
 {
-    if(adjacencyList.find(v) == adjacencyList.end())
+    if(!vertices.contains(v))
     {
         throw std::runtime_error("Vertex does not exist");
     }
+    if(!directed)
+    {
+        return outList(v);
+    }
 
-    std::vector<int> result;
+    const auto& out = outList(v);
+    const auto& in = inList(v);
 
-    for(const auto& [edgeId, edge] : edges)
+    std::vector<int> result;
+    result.reserve(out.size() + in.size());
+    result.insert(result.end(), out.begin(), out.end());
+    for(int edgeId : in)
     {
-        if(edge.v1 == v || edge.v2 == v)
+        if(edges.at(edgeId).v1 != v)
             result.push_back(edgeId);
     }
 
     return result;
 }
 
+// Zwraca identyfikatory krawędzi wychodzących z v (v jest ich początkiem).
+// Złożoność czasowa: O(d_out), pamięciowa: O(d_out)
+template <typename W>
+std::vector<int> BasicAdjacencyListGraph<W>::outEdges(int v) const
+{
+    if(!vertices.contains(v))
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    return outList(v);
+}
+
+// Zwraca identyfikatory krawędzi wchodzących do v (v jest ich końcem).
+// Złożoność czasowa: O(d_in), pamięciowa: O(d_in)
+template <typename W>
+std::vector<int> BasicAdjacencyListGraph<W>::inEdges(int v) const
+{
+    if(!vertices.contains(v))
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    return inList(v);
+}
+
 
 
 //Metody dostepu
@@ -155,26 +301,43 @@ std::vector<int> AdjacencyListGraph::incidentEdges(int v) const
 // Zwraca parę wierzchołków końcowych krawędzi o podanym identyfikatorze.
 // Złożoność czasowa: O(1), pamięciowa: O(1)
 
-std::vector<int> AdjacencyListGraph::endVertices(int edge) const
+template <typename W>
+std::vector<int> BasicAdjacencyListGraph<W>::endVertices(int edge) const
 {
-    if(edges.find(edge) == edges.end())
+    const Edge* e = edges.find(edge);
+    if(e == nullptr)
     {
         throw std::runtime_error("Edge does not exist");
     }
-    const Edge& e = edges.at(edge);
-    return {e.v1, e.v2};
+    return {e->v1, e->v2};
 }
 
 // Sprawdza, czy wierzchołki v1 i v2 są połączone krawędzią.
-// Przechodzi po wszystkich krawędziach incydentnych do v1 i sprawdza, czy v2 jest drugim końcem.
-// Złożoność czasowa: O(d1), gdzie d1 to liczba krawędzi incydentnych do v1.
+// Z indeksem bitowym odczytuje jeden bit, bez niego przechodzi po krawędziach wychodzących z v1
+// i sprawdza, czy v2 jest drugim końcem.
+// Złożoność czasowa: O(1) z indeksem bitowym, w przeciwnym razie O(d1), gdzie d1 to liczba krawędzi wychodzących z v1.
 // Pamięciowa: O(1)
-bool AdjacencyListGraph::areAdjacent(int v1, int v2) const
+template <typename W>
+bool BasicAdjacencyListGraph<W>::areAdjacent(int v1, int v2) const
 {
-    for (int edgeId : adjacencyList.at(v1))
+    if(!vertices.contains(v1))
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+
+    if(adjacencyBitset)
+    {
+        if(!vertices.contains(v2))
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        return adjacencyBitset->test(VertexMap::indexOf(v1), VertexMap::indexOf(v2));
+    }
+
+    for (int edgeId : outList(v1))
     {
         const Edge& e = edges.at(edgeId);
-        if(e.v1 == v2 || e.v2 == v2)
+        if((e.v1 == v1 ? e.v2 : e.v1) == v2)
             return 1;
     }
     return 0;
@@ -183,14 +346,15 @@ bool AdjacencyListGraph::areAdjacent(int v1, int v2) const
 // Zwraca wierzchołek przeciwny do v na krawędzi e.
 // Jeśli v nie jest końcem krawędzi e, rzuca wyjątek.
 // Złożoność czasowa: O(1), pamięciowa: O(1)
-int AdjacencyListGraph::opposite(int v, int e) const
+template <typename W>
+int BasicAdjacencyListGraph<W>::opposite(int v, int e) const
 {
-    auto edgeId = edges.find(e);
-    if (edgeId == edges.end())
+    const Edge* edgeId = edges.find(e);
+    if (edgeId == nullptr)
     {
         throw std::runtime_error("Edge does not exist");
     }
-    const Edge& edge = edgeId->second;
+    const Edge& edge = *edgeId;
     if(edge.v1 == v)
         return edge.v2;
     else if(edge.v2 == v)
@@ -199,31 +363,190 @@ int AdjacencyListGraph::opposite(int v, int e) const
     throw std::runtime_error("Vertex does not belong to the edge");
 }
 
+// Zwraca wagę krawędzi e.
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+W BasicAdjacencyListGraph<W>::edgeWeight(int e) const
+{
+    const Edge* edgeId = edges.find(e);
+    if (edgeId == nullptr)
+    {
+        throw std::runtime_error("Edge does not exist");
+    }
+    return edgeId->weight;
+}
+
 
 // Zmienia wartość wierzchołka v na val.
 // Złożoność czasowa: O(1), pamięciowa: O(1)
-void AdjacencyListGraph::replaceVertices(int v, int val)
+template <typename W>
+void BasicAdjacencyListGraph<W>::replaceVertices(int v, int val)
 {
-    auto vertexId = vertices.find(v);
-    if (vertexId == vertices.end())
+    int* vertexId = vertices.find(v);
+    if (vertexId == nullptr)
     {
         throw std::runtime_error("Vertex does not exist");
     }
 
-    vertexId->second = val;
+    *vertexId = val;
 }
 
 // Zmienia wagę krawędzi e na weight.
 // Złożoność czasowa: O(1), pamięciowa: O(1)
-void AdjacencyListGraph::replaceEdges(int e, int weight)
+template <typename W>
+void BasicAdjacencyListGraph<W>::replaceEdges(int e, W weight)
 {
-    auto edgeId = edges.find(e);
-    if (edgeId == edges.end())
+    Edge* edgeId = edges.find(e);
+    if (edgeId == nullptr)
     {
         throw std::runtime_error("Edge not existing");
     }
 
-    edgeId->second.weight = weight;
+    edgeId->weight = weight;
+}
+
+
+// metody bez alokacji
+
+// Zwraca parę końców krawędzi e bez alokowania wektora.
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+std::pair<int, int> BasicAdjacencyListGraph<W>::endpoints(int e) const
+{
+    const Edge* edge = edges.find(e);
+    if(edge == nullptr)
+    {
+        throw std::runtime_error("Edge does not exist");
+    }
+    return {edge->v1, edge->v2};
+}
+
+// Złożoność czasowa: O(V), pamięciowa: O(1)
+template <typename W>
+void BasicAdjacencyListGraph<W>::forEachVertex(FunctionRef<void(int v)> visit) const
+{
+    vertices.forEach([&visit](int id, int) { visit(id); });
+}
+
+// Złożoność czasowa: O(E), pamięciowa: O(1)
+template <typename W>
+void BasicAdjacencyListGraph<W>::forEachEdge(typename BasicGraph<W>::EdgeVisitor visit) const
+{
+    edges.forEach([&visit](int id, const Edge& edge) { visit(id, edge.v1, edge.v2, edge.weight); });
+}
+
+// Przechodzi po liście krawędzi wychodzących v.
+// Złożoność czasowa: O(d_out), pamięciowa: O(1)
+template <typename W>
+void BasicAdjacencyListGraph<W>::forEachOutNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const
+{
+    if(!vertices.contains(v))
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    for(int edgeId : outList(v))
+    {
+        const Edge& edge = edges.valueAt(EdgeMap::indexOf(edgeId));
+        visit(edge.v1 == v ? edge.v2 : edge.v1, edgeId, edge.weight);
+    }
+}
+
+// Przechodzi po liście krawędzi wchodzących do v.
+// Złożoność czasowa: O(d_in), pamięciowa: O(1)
+template <typename W>
+void BasicAdjacencyListGraph<W>::forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const
+{
+    if(!vertices.contains(v))
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    for(int edgeId : inList(v))
+    {
+        const Edge& edge = edges.valueAt(EdgeMap::indexOf(edgeId));
+        visit(edge.v2 == v ? edge.v1 : edge.v2, edgeId, edge.weight);
+    }
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+Span<const int> BasicAdjacencyListGraph<W>::outEdgeIds(int v) const
+{
+    if(!vertices.contains(v))
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    return outList(v);
+}
+
+// Buduje indeks bitowy sąsiedztwa z istniejących krawędzi; dalej jest aktualizowany
+// przez insertEdge / removeEdge / removeVertex.
+// Złożoność czasowa: O(V^2 / 64 + E), pamięciowa: O(V^2 / 8) bajtów
+template <typename W>
+void BasicAdjacencyListGraph<W>::enableAdjacencyBitset()
+{
+    adjacencyBitset.emplace();
+    adjacencyBitset->resize(vertices.slotCount());
+    edges.forEach([this](int, const Edge& edge) { setAdjacencyBits(edge.v1, edge.v2); });
+}
+
+template <typename W>
+void BasicAdjacencyListGraph<W>::disableAdjacencyBitset()
+{
+    adjacencyBitset.reset();
+}
+
+// Liczba wspólnych następników v1 i v2 (wymaga indeksu bitowego).
+// Złożoność czasowa: O(V / 64)
+template <typename W>
+int BasicAdjacencyListGraph<W>::commonNeighborCount(int v1, int v2) const
+{
+    if(!adjacencyBitset)
+    {
+        throw std::logic_error("Adjacency bitset is not enabled");
+    }
+    if(!vertices.contains(v1) || !vertices.contains(v2))
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    return adjacencyBitset->intersectionCount(VertexMap::indexOf(v1), VertexMap::indexOf(v2));
+}
+
+// Liczba wierzchołków będących następnikiem v1 lub v2 (wymaga indeksu bitowego).
+// Złożoność czasowa: O(V / 64)
+template <typename W>
+int BasicAdjacencyListGraph<W>::neighborUnionCount(int v1, int v2) const
+{
+    if(!adjacencyBitset)
+    {
+        throw std::logic_error("Adjacency bitset is not enabled");
+    }
+    if(!vertices.contains(v1) || !vertices.contains(v2))
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    return adjacencyBitset->unionCount(VertexMap::indexOf(v1), VertexMap::indexOf(v2));
+}
+
+// Identyfikatory wspólnych następników v1 i v2 (wymaga indeksu bitowego).
+// Złożoność czasowa: O(V / 64 + wynik)
+template <typename W>
+std::vector<int> BasicAdjacencyListGraph<W>::commonNeighbors(int v1, int v2) const
+{
+    if(!adjacencyBitset)
+    {
+        throw std::logic_error("Adjacency bitset is not enabled");
+    }
+    if(!vertices.contains(v1) || !vertices.contains(v2))
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+
+    std::vector<int> result = adjacencyBitset->intersection(VertexMap::indexOf(v1), VertexMap::indexOf(v2));
+    for(int& index : result)
+    {
+        index = vertices.keyAt(index);
+    }
+    return result;
 }
 
 
@@ -231,22 +554,47 @@ void AdjacencyListGraph::replaceEdges(int e, int weight)
 // Najpierw wczytuje liczbę wierzchołków i krawędzi, następnie dodaje wierzchołki i krawędzie.
 // Złożoność czasowa: O(V + E), pamięciowa: O(V + E)
 
-std::unique_ptr<Graph> AdjacencyListGraph::createGraph(std::istream& is)
+template <typename W>
+std::unique_ptr<BasicGraph<W>> BasicAdjacencyListGraph<W>::createGraph(std::istream& is, EdgeDirection direction)
 {
-    auto graph = std::make_unique<AdjacencyListGraph>();
-    int vertexCount, edgeCount;
-    is >> vertexCount >> edgeCount;
-
-    for(int i = 0; i < vertexCount; ++i)
+    BasicEdgeList<W> edgeList;
+    int edgeCount;
+    is >> edgeList.vertexCount >> edgeCount;
+    if(!is)
+        throw std::invalid_argument("Invalid input format");
+
+    // Najpierw cale wejscie, potem jedno hurtowe wstawienie krawedzi.
+    // Waga spoza zakresu W (np. 300 dla uint8_t) ustawia failbit i odrzuca wejscie.
+    edgeList.edges.resize(edgeCount);
+    for(auto& edge : edgeList.edges)
     {
-        graph->insertVertex();
+        is >> edge.v1 >> edge.v2;
+        edge.weight = readWeight<W>(is);
+        if(!is)
+            throw std::invalid_argument("Invalid edge format");
     }
 
-    for(int i = 0; i < edgeCount; ++i)
+    return createGraph(edgeList, direction);
+}
+
+// Tworzy graf z wczytanej listy krawędzi (np. przez loadEdgeList).
+// Złożoność czasowa: O(V + E), pamięciowa: O(V + E)
+template <typename W>
+std::unique_ptr<BasicGraph<W>> BasicAdjacencyListGraph<W>::createGraph(const BasicEdgeList<W>& edgeList,
+                                                                      EdgeDirection direction)
+{
+    auto graph = std::make_unique<BasicAdjacencyListGraph<W>>(direction);
+    graph->insertVertices(edgeList.vertexCount);
+
+    if(direction == EdgeDirection::Undirected)
+    {
+        auto input = edgeList.edges;
+        collapseReciprocalEdges(input);
+        graph->insertEdges(input);
+    }
+    else
     {
-        int v1, v2, weight;
-        is >> v1 >> v2 >> weight;
-        graph->insertEdge(v1, v2, weight);
+        graph->insertEdges(edgeList.edges);
     }
 
     return graph;
@@ -255,7 +603,8 @@ std::unique_ptr<Graph> AdjacencyListGraph::createGraph(std::istream& is)
 
 
 
-void AdjacencyListGraph::printGraph() const
+template <typename W>
+void BasicAdjacencyListGraph<W>::printGraph() const
 {
 
      std::cout << "\n=== REPREZENTACJA GRAFU ===\n";
@@ -266,39 +615,38 @@ void AdjacencyListGraph::printGraph() const
      std::cout << vertices.size() << " " << edges.size() << std::endl;
 
       // Wypisz wszystkie krawędzie w formacie: v1 v2 waga
-      for(const auto& [id, edge] : edges)
-      {
-             std::cout << edge.v1 << " " << edge.v2 << " " << edge.weight << std::endl;
-      }
+      edges.forEach([](int, const Edge& edge) {
+             std::cout << edge.v1 << " " << edge.v2 << " " << printableWeight(edge.weight) << std::endl;
+      });
  
 
     // Wypisz wszystkie wierzchołki
     std::cout << "Wierzcholki: ";
-     for(const auto& [id, val] : vertices)
-     {
+     vertices.forEach([](int id, int val) {
          std::cout << id << "("<< val << ") ";
-     }
+     });
    
     std::cout << "\n\n";
 
     // Wypisz wszystkie krawędzie
     std::cout << "Krawedzie:\n";
-    for(const auto& [id, edge] : edges)
-    {
-        std::cout << "  " << edge.v1 << " --" << edge.weight << "--> " << edge.v2 << "\n";
-    }
+    edges.forEach([](int, const Edge& edge) {
+        std::cout << "  " << edge.v1 << " --" << printableWeight(edge.weight) << "--> " << edge.v2 << "\n";
+    });
 
     // Wypisz listy sąsiedztwa
     std::cout << "\nListy sasiedztwa:\n";
-    for(const auto& [vertex, edgeIds] : adjacencyList)
-    {
+    vertices.forEach([this](int vertex, int) {
         std::cout << "  " << vertex << ": ";
-        for(int edgeId : edgeIds)
+        for(int edgeId : outList(vertex))
         {
             const Edge& e = edges.at(edgeId);
             int neighbor = (e.v1 == vertex) ? e.v2 : e.v1;
-            std::cout << neighbor << "(" << e.weight << ", "<< edgeId << ") ";
+            std::cout << neighbor << "(" << printableWeight(e.weight) << ", "<< edgeId << ") ";
         }
         std::cout << "\n";
-    }
-}
\ No newline at end of file
+    });
+}
+
+#define GRAPHS_INSTANTIATE_LIST_GRAPH(W) template class BasicAdjacencyListGraph<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_LIST_GRAPH)
@@ -5,121 +5,237 @@
 #include <iomanip>
 
 
-int AdjacencyMatrixGraph::insertVertex(int val = 0)
+// Przenosi macierz do bufora o pojemnosci newCapacity x newCapacity, nowe pola wypelnia NO_EDGE.
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::growTo(int newCapacity)
 {
-    int newIndex = nextVertexIndex++;
-    vertices[newIndex] = val;
+    std::vector<int> grown(static_cast<std::size_t>(newCapacity) * newCapacity, NO_EDGE);
+    int used = std::min(slotCount(), capacity);
+    for (int row = 0; row < used; ++row)
+    {
+        std::copy_n(edgeIdMatrix.begin() + position(row, 0), used,
+                    grown.begin() + static_cast<std::size_t>(row) * newCapacity);
+    }
+    edgeIdMatrix.swap(grown);
+    capacity = newCapacity;
+}
 
-    //Dodanie nowego wiersza wypelnionego INF
-    adjacencyMatrix.push_back(std::vector<int>(newIndex, INF));
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::reserve(int vertexCount)
+{
+    vertices.reserve(vertexCount);
+    if (vertexCount > capacity)
+        growTo(vertexCount);
+}
 
+// Zajmuje slot w vertices; zwolniony slot ma juz wyczyszczony wiersz i kolumne.
+template <typename W>
+int BasicAdjacencyMatrixGraph<W>::insertVertex(int val)
+{
+    int id = vertices.insert(val);
 
-    //Rozszerzenie istniejacych wierszy
-    for (auto& row : adjacencyMatrix)
-    {
-        row.push_back(INF);
-    }
-    return newIndex;
+    //Podwojenie pojemnosci, gdy nowy wiersz i kolumna sie nie mieszcza
+    if (slotOf(id) >= capacity)
+        growTo(std::max(1, capacity * 2));
+
+    return id;
 }
 
 
-int AdjacencyMatrixGraph::insertEdge(int v1, int v2, int weight)
+// Macierz przechowuje jedna krawedz na uporzadkowana pare wierzcholkow
+// (w grafie nieskierowanym na nieuporzadkowana): krawedz wstawiona na zajete pole zastepuje poprzednia.
+template <typename W>
+int BasicAdjacencyMatrixGraph<W>::insertEdge(int v1, int v2, W weight)
 {
-    if(vertices.find(v1) == vertices.end() || vertices.find(v2) == vertices.end())
+    if(!vertices.contains(v1) || !vertices.contains(v2))
         throw std::out_of_range("Podany wierzcholek nie istnieje");
 
+    return placeEdge(v1, v2, weight, false);
+}
+
+// Zapisuje krawedz w polu (v1, v2), a w grafie nieskierowanym rowniez w (v2, v1).
+// Wierzcholki musza byc juz sprawdzone; append wymusza nowy slot w mapie krawedzi (wstawianie hurtowe).
+template <typename W>
+int BasicAdjacencyMatrixGraph<W>::placeEdge(int v1, int v2, W weight, bool append)
+{
+    int row = slotOf(v1), col = slotOf(v2);
+    if(edgeCell(row, col) != NO_EDGE)
+        edges.erase(edgeCell(row, col));
 
-    int newEdgeIndex = nextEdgeIndex++;
-    adjacencyMatrix[v1][v2] = weight;
+    int newEdgeIndex = append ? edges.append({v1, v2, weight}) : edges.insert({v1, v2, weight});
+    edgeCell(row, col) = newEdgeIndex;
+    if(!directed)
+        edgeCell(col, row) = newEdgeIndex;
 
-    edges[newEdgeIndex] = {v1, v2, weight};
     return newEdgeIndex;
 }
 
-
-void AdjacencyMatrixGraph::removeVertex(int v)
+// Nowe sloty na koncu mapy (bez wolnych slotow), wiec identyfikatory sa kolejne; jedno powiekszenie macierzy.
+// Złożoność czasowa: O(n) + O(V^2) przy powiekszeniu
+template <typename W>
+int BasicAdjacencyMatrixGraph<W>::insertVertices(int n)
 {
+    if(n < 0)
+        throw std::invalid_argument("Ujemna liczba wierzcholkow");
 
-    if(vertices.find(v) == vertices.end())
-        throw std::out_of_range("Wierzcholek nie istnieje");
+    int first = slotCount();
+    vertices.reserve(first + n);
+    if(first + n > capacity)
+        growTo(std::max(first + n, capacity * 2));
 
-    for (auto edgeIt = edges.begin(); edgeIt != edges.end();)
-    {
-        Edge& edge = edgeIt->second;
-        if (edge.v1 == v || edge.v2 == v)
-        {
-            adjacencyMatrix[edge.v1][edge.v2] = INF;
-            adjacencyMatrix[edge.v2][edge.v1] = INF;
-            edgeIt = edges.erase(edgeIt);
+    for(int i = 0; i < n; ++i)
+        vertices.append(0);
 
-        }
-        else
-        {
-            ++edgeIt;
-        }
+    return first;
+}
+
+// Sprawdza wszystkie konce przed wstawieniem; krawedz na zajetym polu zastepuje poprzednia, jak w insertEdge.
+// Złożoność czasowa: O(m)
+template <typename W>
+int BasicAdjacencyMatrixGraph<W>::insertEdges(Span<const typename BasicGraph<W>::EdgeInput> input)
+{
+    for(const auto& edge : input)
+    {
+        if(!vertices.contains(edge.v1) || !vertices.contains(edge.v2))
+            throw std::out_of_range("Podany wierzcholek nie istnieje");
     }
 
+    int first = edges.slotCount();
+    edges.reserve(first + static_cast<int>(input.size()));
+    for(const auto& edge : input)
+        placeEdge(edge.v1, edge.v2, edge.weight, true);
+
+    return first;
+}
 
-    adjacencyMatrix.erase(adjacencyMatrix.begin() + v);
-    for (auto& row : adjacencyMatrix)
+// Usuwa krawedz zapisana w polu (row, col), jesli istnieje.
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::eraseEdgeAt(int row, int col)
+{
+    int& edgeId = edgeCell(row, col);
+    if(edgeId == NO_EDGE)
+        return;
+
+    edges.erase(edgeId);
+    edgeId = NO_EDGE;
+    if(!directed)
+        edgeCell(col, row) = NO_EDGE;
+}
+
+
+// Usuwa krawedzie z wiersza i kolumny v, bez przegladania calej mapy krawedzi.
+// Złożoność czasowa: O(V)
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::removeVertex(int v)
+{
+
+    if(!vertices.contains(v))
+        throw std::out_of_range("Wierzcholek nie istnieje");
+
+    //Wiersz i kolumna zostaja w buforze, identyfikatory pozostalych wierzcholkow sie nie zmieniaja
+    int slot = slotOf(v);
+    for (int i = 0; i < slotCount(); ++i)
     {
-        row.erase(row.begin() + v);
+        eraseEdgeAt(slot, i);
+        eraseEdgeAt(i, slot);
     }
     vertices.erase(v);
 
 }
 
 
-void AdjacencyMatrixGraph::removeEdge(int e) 
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::removeEdge(int e) 
 {
-    if(edges.find(e) == edges.end())
+    if(!edges.contains(e))
         throw std::out_of_range("Krawedz nie istnieje");
 
-    Edge& edge = edges[e];
-    adjacencyMatrix[edge.v1][edge.v2] = INF;
-    edges.erase(e);
+    const Edge& edge = edges.at(e);
+    eraseEdgeAt(slotOf(edge.v1), slotOf(edge.v2));
    
 }
 
 
-std::vector<int> AdjacencyMatrixGraph::showVertices() const
+template <typename W>
+std::vector<int> BasicAdjacencyMatrixGraph<W>::showVertices() const
+{
+    std::vector<int> result;
+    result.reserve(vertices.size());
+    vertices.forEach([&result](int id, int) { result.push_back(id); });
+    return result;
+}
+
+template <typename W>
+std::vector<int> BasicAdjacencyMatrixGraph<W>::showEdges() const
 {
     std::vector<int> result;
-    for (const auto& [idx, val] : vertices)
+    result.reserve(edges.size());
+    edges.forEach([&result](int id, const Edge&) { result.push_back(id); });
+    return result;
+}
+
+
+// Krawedzie wychodzace (skan wiersza v), a potem wchodzace (skan kolumny v, petla wlasna tylko raz).
+// W grafie nieskierowanym wiersz v zawiera juz wszystkie krawedzie incydentne.
+// Złożoność czasowa: O(V)
+template <typename W>
+std::vector<int> BasicAdjacencyMatrixGraph<W>::incidentEdges(int v) const
+{
+    std::vector<int> result = outEdges(v);
+    if(!directed)
+        return result;
+
+    int col = slotOf(v);
+    for(int row = 0; row < slotCount(); ++row)
     {
-        result.push_back(idx);
+        int edgeId = edgeCell(row, col);
+        if(edgeId != NO_EDGE && row != col)
+            result.push_back(edgeId);
     }
     return result;
 }
 
-std::vector<int> AdjacencyMatrixGraph::showEdges() const
+// Skan wiersza v macierzy identyfikatorow.
+// Złożoność czasowa: O(V)
+template <typename W>
+std::vector<int> BasicAdjacencyMatrixGraph<W>::outEdges(int v) const
 {
+    if(!vertices.contains(v))
+        throw std::out_of_range("Wierzcholek nie istnieje");
+
     std::vector<int> result;
-    for (const auto& [idx, _] : edges)
+    const int* row = edgeIdMatrix.data() + position(slotOf(v), 0);
+    for(int col = 0; col < slotCount(); ++col)
     {
-        result.push_back(idx);
+        if(row[col] != NO_EDGE)
+            result.push_back(row[col]);
     }
     return result;
 }
 
-
-std::vector<int> AdjacencyMatrixGraph::incidentEdges(int v) const
+// Skan kolumny v macierzy identyfikatorow.
+// Złożoność czasowa: O(V)
+template <typename W>
+std::vector<int> BasicAdjacencyMatrixGraph<W>::inEdges(int v) const
 {
-    if(vertices.find(v) == vertices.end())
+    if(!vertices.contains(v))
         throw std::out_of_range("Wierzcholek nie istnieje");
 
     std::vector<int> result;
-    for(const auto& [edgeId, edge] : edges)
+    int col = slotOf(v);
+    for(int row = 0; row < slotCount(); ++row)
     {
-        if(edge.v1 == v || edge.v2 == v)
+        int edgeId = edgeCell(row, col);
+        if(edgeId != NO_EDGE)
             result.push_back(edgeId);
     }
     return result;
 }
 
-std::vector<int> AdjacencyMatrixGraph::endVertices(int edge) const
+template <typename W>
+std::vector<int> BasicAdjacencyMatrixGraph<W>::endVertices(int edge) const
 {
-    if(edges.find(edge) == edges.end())
+    if(!edges.contains(edge))
         throw std::out_of_range("Krawedz nie istnieje");
 
     const Edge& e = edges.at(edge);
@@ -128,14 +244,19 @@ std::vector<int> AdjacencyMatrixGraph::endVertices(int edge) const
 }
 
 
-bool AdjacencyMatrixGraph::areAdjacent(int v1, int v2) const
+template <typename W>
+bool BasicAdjacencyMatrixGraph<W>::areAdjacent(int v1, int v2) const
 {
-    return adjacencyMatrix[v1][v2] != INF;
+    if(!vertices.contains(v1) || !vertices.contains(v2))
+        throw std::out_of_range("Wierzcholek nie istnieje");
+
+    return edgeCell(slotOf(v1), slotOf(v2)) != NO_EDGE;
 }
 
-int AdjacencyMatrixGraph::opposite(int v, int edge) const
+template <typename W>
+int BasicAdjacencyMatrixGraph<W>::opposite(int v, int edge) const
 {
-    if(edges.find(edge) == edges.end())
+    if(!edges.contains(edge))
         throw std::out_of_range("Krawedz nie istnieje");
 
     const Edge& e = edges.at(edge);
@@ -146,26 +267,91 @@ int AdjacencyMatrixGraph::opposite(int v, int edge) const
     throw std::invalid_argument("Wierzcholek nie jest czescia krawedzi");
 }
 
-void AdjacencyMatrixGraph::replaceVertices(int v, int val)
+template <typename W>
+W BasicAdjacencyMatrixGraph<W>::edgeWeight(int e) const
 {
-    if(vertices.find(v) == vertices.end())
+    if(!edges.contains(e))
+        throw std::out_of_range("Krawedz nie istnieje");
+
+    return edges.at(e).weight;
+}
+
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::replaceVertices(int v, int val)
+{
+    if(!vertices.contains(v))
         throw std::out_of_range("Wierzcholek nie istnieje");
 
-    vertices[v] = val;
+    vertices.at(v) = val;
 }
 
-void AdjacencyMatrixGraph::replaceEdges(int e, int weight)
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::replaceEdges(int e, W weight)
 {
-    if(edges.find(e) == edges.end())
+    if(!edges.contains(e))
         throw std::out_of_range("Krawedz nie istnieje");
 
-    Edge& edge = edges[e];
-    adjacencyMatrix[edge.v1][edge.v2] = weight;
-    edges[e].weight = weight;
-    
+    edges.at(e).weight = weight;
 }
 
-void AdjacencyMatrixGraph::printGraph() const
+template <typename W>
+std::pair<int, int> BasicAdjacencyMatrixGraph<W>::endpoints(int e) const
+{
+    const Edge* edge = edges.find(e);
+    if(edge == nullptr)
+        throw std::out_of_range("Krawedz nie istnieje");
+
+    return {edge->v1, edge->v2};
+}
+
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::forEachVertex(FunctionRef<void(int v)> visit) const
+{
+    vertices.forEach([&visit](int id, int) { visit(id); });
+}
+
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::forEachEdge(typename BasicGraph<W>::EdgeVisitor visit) const
+{
+    edges.forEach([&visit](int id, const Edge& edge) { visit(id, edge.v1, edge.v2, edge.weight); });
+}
+
+// Skan wiersza v: sasiad to klucz wierzcholka w kolumnie, waga z rekordu krawedzi.
+// Złożoność czasowa: O(V)
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::forEachOutNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const
+{
+    if(!vertices.contains(v))
+        throw std::out_of_range("Wierzcholek nie istnieje");
+
+    std::size_t rowStart = position(slotOf(v), 0);
+    for(int col = 0; col < slotCount(); ++col)
+    {
+        int edgeId = edgeIdMatrix[rowStart + col];
+        if(edgeId != NO_EDGE)
+            visit(vertices.keyAt(col), edgeId, weightOf(edgeId));
+    }
+}
+
+// Skan kolumny v.
+// Złożoność czasowa: O(V)
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const
+{
+    if(!vertices.contains(v))
+        throw std::out_of_range("Wierzcholek nie istnieje");
+
+    int col = slotOf(v);
+    for(int row = 0; row < slotCount(); ++row)
+    {
+        int edgeId = edgeCell(row, col);
+        if(edgeId != NO_EDGE)
+            visit(vertices.keyAt(row), edgeId, weightOf(edgeId));
+    }
+}
+
+template <typename W>
+void BasicAdjacencyMatrixGraph<W>::printGraph() const
 {
 
     std::cout << "\n=== REPREZENTACJA GRAFU ===\n";
@@ -176,24 +362,22 @@ void AdjacencyMatrixGraph::printGraph() const
     std::cout << vertices.size() << " " << edges.size() << std::endl;
 
     // Wypisz wszystkie krawędzie w formacie: v1 v2 waga
-    for(const auto& [id, edge] : edges)
-    {
-        std::cout << edge.v1 << " " << edge.v2 << " " << edge.weight << std::endl;
-    }
+    edges.forEach([](int, const Edge& edge) {
+        std::cout << edge.v1 << " " << edge.v2 << " " << printableWeight(edge.weight) << std::endl;
+    });
 
     // Wypisz wszystkie wierzchołki
     std::cout << "Wierzcholki: ";
-    for(const auto& [id, val] : vertices)
-    {
+    vertices.forEach([](int id, int) {
         std::cout << id << " ";
-    }
+    });
 
     std::cout << "\n\n";
 
     // Nagłówek
     std::cout << "Macierz sąsiedztwa:\n";
     std::cout << "     ";
-    for(int j = 0; j < nextVertexIndex; ++j)
+    for(int j = 0; j < slotCount(); ++j)
     {
         std::cout << std::setw(1) << j << " ";
     }
@@ -201,65 +385,81 @@ void AdjacencyMatrixGraph::printGraph() const
 
     // Separator
     std::cout << "   +";
-    for(int j = 0; j < nextVertexIndex; ++j)
+    for(int j = 0; j < slotCount(); ++j)
     {
         std::cout << "----";
     }
     std::cout << "\n";
 
     // Zawartość
-    for(int i = 0; i < nextVertexIndex; ++i)
+    for(int i = 0; i < slotCount(); ++i)
     {
         std::cout << std::setw(2) << i << " |";
-        for(int j = 0; j < nextVertexIndex; ++j)
+        for(int j = 0; j < slotCount(); ++j)
         {
-            if(adjacencyMatrix[i][j] == INF)
+            if(edgeCell(i, j) == NO_EDGE)
             {
                 std::cout << std::setw(3) << u8"\u221E" << " ";
             }
             else
             {
-                std::cout << std::setw(3) << adjacencyMatrix[i][j] << " ";
+                std::cout << std::setw(3) << printableWeight(weightOf(edgeCell(i, j))) << " ";
             }
         }
         std::cout << "\n";
     }
 
     std::cout << "Legenda krawedzi";
-    for (const auto& [id, edge] : edges)
-    {
-        std::cout << "\nId " << id << ": " << edge.v1 << " --" << edge.weight << "--> " << edge.v2;
-    }
+    edges.forEach([](int id, const Edge& edge) {
+        std::cout << "\nId " << id << ": " << edge.v1 << " --" << printableWeight(edge.weight) << "--> " << edge.v2;
+    });
     std::cout << "\n";
 
 }
 
 
-std::unique_ptr<Graph> AdjacencyMatrixGraph::createGraph(std::istream& is)
+template <typename W>
+std::unique_ptr<BasicGraph<W>> BasicAdjacencyMatrixGraph<W>::createGraph(std::istream& is, EdgeDirection direction)
 {
-    int vertexCount, edgesCount;
-    is >> vertexCount >> edgesCount;
+    BasicEdgeList<W> edgeList;
+    int edgesCount;
+    is >> edgeList.vertexCount >> edgesCount;
     if(!is)
         throw std::invalid_argument("Nieprawidlowy format wejscia");
 
-    auto graph = std::make_unique<AdjacencyMatrixGraph>();
-
-    for (int i = 0; i < vertexCount; i++)
-    {
-        graph->insertVertex();
-    }
-
-    for (int i = 0; i < edgesCount; i++)
+    edgeList.edges.resize(edgesCount);
+    for (auto& edge : edgeList.edges)
     {
-        int v1, v2, weight;
-        is >> v1 >> v2 >> weight;
+        is >> edge.v1 >> edge.v2;
+        edge.weight = readWeight<W>(is);
         if(!is)
             throw std::invalid_argument("Nieprawidlowy format krawedzi");
-        
-        graph->insertEdge(v1, v2, weight);
     }
 
+    return createGraph(edgeList, direction);
+}
+
+// Wierzcholki w jednym powiekszeniu macierzy, krawedzie jednym wstawieniem hurtowym.
+template <typename W>
+std::unique_ptr<BasicGraph<W>> BasicAdjacencyMatrixGraph<W>::createGraph(const BasicEdgeList<W>& edgeList,
+                                                                        EdgeDirection direction)
+{
+    auto graph = std::make_unique<BasicAdjacencyMatrixGraph<W>>(direction);
+    graph->insertVertices(edgeList.vertexCount);
 
+    if(direction == EdgeDirection::Undirected)
+    {
+        auto input = edgeList.edges;
+        collapseReciprocalEdges(input);
+        graph->insertEdges(input);
+    }
+    else
+    {
+        graph->insertEdges(edgeList.edges);
+    }
 
     return graph;
 }
+
+#define GRAPHS_INSTANTIATE_MATRIX_GRAPH(W) template class BasicAdjacencyMatrixGraph<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_MATRIX_GRAPH)
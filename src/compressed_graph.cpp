@@ -0,0 +1,186 @@
+#include "graphs/compressed_graph.hpp"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace
+{
+// Dopisuje wartosci jako grupy po 4 (ostatnia grupa uzupelniona zerami)
+void appendGroupVarint(std::vector<std::uint8_t>& bytes, const std::vector<std::uint32_t>& values)
+{
+    for(std::size_t first = 0; first < values.size(); first += 4)
+    {
+        std::size_t tagPosition = bytes.size();
+        bytes.push_back(0);
+        for(int i = 0; i < 4; ++i)
+        {
+            std::uint32_t value = first + i < values.size() ? values[first + i] : 0;
+            int length = value <= 0xff ? 1 : value <= 0xffff ? 2 : value <= 0xffffff ? 3 : 4;
+            bytes[tagPosition] |= static_cast<std::uint8_t>((length - 1) << (2 * i));
+            for(int b = 0; b < length; ++b)
+            {
+                bytes.push_back(static_cast<std::uint8_t>(value >> (8 * b)));
+            }
+        }
+    }
+}
+
+std::uint32_t zigzagEncode(int value)
+{
+    return (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+}
+
+// Dopisuje rosnacy ciag: pierwsza wartosc jako roznica (zigzag) wzgledem base, kolejne jako odstepy
+void appendSortedList(std::vector<std::uint8_t>& bytes, const std::vector<int>& values, int base,
+                      std::vector<std::uint32_t>& codes)
+{
+    codes.clear();
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        if(i == 0)
+            codes.push_back(zigzagEncode(values[0] - base));
+        else
+            codes.push_back(static_cast<std::uint32_t>(values[i] - values[i - 1]));
+    }
+    appendGroupVarint(bytes, codes);
+}
+} // namespace
+
+// Buduje graf z krawedzi podanych w kolejnosci wstawienia: po uporzadkowaniu krawedzi (assignEdges) koduje
+// listy nastepnikow jako odstepy (group varint). Indeks odwrotny powstaje z sortowania przez zliczanie nowych
+// identyfikatorow po koncu, wiec listy wchodzace sa od razu rosnace.
+// Złożoność czasowa: O(V + E log d_max), pamięciowa: O(V + E)
+template <typename W>
+std::unique_ptr<BasicCompressedGraph<W>> BasicCompressedGraph<W>::build(std::vector<int> ids,
+                                                                        const std::vector<int>& sources,
+                                                                        const std::vector<int>& targets,
+                                                                        const std::vector<W>& weights)
+{
+    auto graph = std::make_unique<BasicCompressedGraph<W>>();
+    std::vector<int> edgeOffsets;
+    std::vector<int> order = graph->assignEdges(std::move(ids), sources, targets, weights, edgeOffsets);
+    int n = graph->vertexCount;
+    int m = graph->edgeCount;
+
+    graph->offsets.resize(n + 1);
+    graph->adjacency.reserve(static_cast<std::size_t>(m) * 2);
+    std::vector<std::uint32_t> codes;
+    std::vector<int> list;
+    for(int u = 0; u < n; ++u)
+    {
+        list.clear();
+        for(int e = edgeOffsets[u]; e < edgeOffsets[u + 1]; ++e)
+        {
+            list.push_back(targets[order[e]]);
+        }
+        graph->offsets[u] = {graph->adjacency.size(), edgeOffsets[u]};
+        appendSortedList(graph->adjacency, list, u, codes);
+    }
+    if(graph->adjacency.size() > ListOffset::MaxByte)
+        throw std::length_error("CompressedGraph adjacency lists exceed 8 GiB");
+    graph->offsets[n] = {graph->adjacency.size(), m};
+    graph->adjacency.resize(graph->adjacency.size() + 8); // zapas dla czytania wartosci po 4 bajty
+    graph->adjacency.shrink_to_fit();
+
+    // Indeks odwrotny: nowe identyfikatory krawedzi pogrupowane po koncu
+    std::vector<int> inPositions(n + 1, 0);
+    for(int target : targets)
+    {
+        ++inPositions[target + 1];
+    }
+    std::partial_sum(inPositions.begin(), inPositions.end(), inPositions.begin());
+
+    std::vector<int> inOrder(m);
+    std::vector<int> next(inPositions.begin(), inPositions.end() - 1);
+    for(int e = 0; e < m; ++e)
+    {
+        inOrder[next[targets[order[e]]]++] = e;
+    }
+
+    graph->inOffsets.resize(n + 1);
+    graph->inAdjacency.reserve(static_cast<std::size_t>(m) * 2);
+    for(int u = 0; u < n; ++u)
+    {
+        list.assign(inOrder.begin() + inPositions[u], inOrder.begin() + inPositions[u + 1]);
+        graph->inOffsets[u] = {graph->inAdjacency.size(), inPositions[u]};
+        appendSortedList(graph->inAdjacency, list, 0, codes);
+    }
+    if(graph->inAdjacency.size() > ListOffset::MaxByte)
+        throw std::length_error("CompressedGraph adjacency lists exceed 8 GiB");
+    graph->inOffsets[n] = {graph->inAdjacency.size(), m};
+    graph->inAdjacency.resize(graph->inAdjacency.size() + 8);
+    graph->inAdjacency.shrink_to_fit();
+    return graph;
+}
+
+// Wierzcholek, do ktorego zakresu identyfikatorow krawedzi nalezy e.
+// Złożoność czasowa: O(log V), pamięciowa: O(1)
+template <typename W>
+int BasicCompressedGraph<W>::sourceIndex(int e) const
+{
+    auto after = std::upper_bound(offsets.begin(), offsets.end(), e,
+                                  [](int edge, const ListOffset& offset) { return edge < offset.edge(); });
+    return static_cast<int>(after - offsets.begin()) - 1;
+}
+
+// Koniec krawedzi e, dekodowany od poczatku listy nastepnikow jej poczatku.
+// Złożoność czasowa: O(log V + d), pamięciowa: O(1)
+template <typename W>
+int BasicCompressedGraph<W>::targetIndex(int e) const
+{
+    auto cursor = neighbors(sourceIndex(e));
+    while(cursor.next() && cursor.edge() != e)
+    {
+    }
+    return cursor.target();
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+std::size_t BasicCompressedGraph<W>::memoryUsage() const
+{
+    return this->sharedMemoryUsage() + (offsets.size() + inOffsets.size()) * sizeof(ListOffset) + adjacency.size() +
+           inAdjacency.size();
+}
+
+// Złożoność czasowa: O(d_in), pamięciowa: O(d_in)
+template <typename W>
+std::vector<int> BasicCompressedGraph<W>::inEdges(int v) const
+{
+    std::vector<int> result;
+    for(auto cursor = inEdgeIds(this->indexOf(v)); cursor.next();)
+    {
+        result.push_back(cursor.edge());
+    }
+    return result;
+}
+
+// Nastepniki sa posortowane, wiec dekodowanie konczy sie na pierwszym nie mniejszym od v2.
+// Złożoność czasowa: O(d1), pamięciowa: O(1)
+template <typename W>
+bool BasicCompressedGraph<W>::areAdjacent(int v1, int v2) const
+{
+    int w = this->indexOf(v2);
+    for(auto cursor = neighbors(this->indexOf(v1)); cursor.next();)
+    {
+        if(cursor.target() >= w)
+            return cursor.target() == w;
+    }
+    return false;
+}
+
+// Poprzednik to poczatek krawedzi wchodzacej, znaleziony po jej identyfikatorze.
+// Złożoność czasowa: O(d_in log V), pamięciowa: O(1)
+template <typename W>
+void BasicCompressedGraph<W>::forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const
+{
+    for(auto cursor = inEdgeIds(this->indexOf(v)); cursor.next();)
+    {
+        visit(this->vertexIds[sourceIndex(cursor.edge())], cursor.edge(), this->weight(cursor.edge()));
+    }
+}
+
+#define GRAPHS_INSTANTIATE_COMPRESSED_GRAPH(W)                                                                         \
+    template class BasicReadOnlyGraph<BasicCompressedGraph<W>, W>;                                                     \
+    template class BasicCompressedGraph<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_COMPRESSED_GRAPH)
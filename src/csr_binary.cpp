@@ -0,0 +1,194 @@
+#include "graphs/csr_binary.hpp"
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "graphs/edge_list.hpp"
+#include "graphs/mapped_file.hpp"
+
+namespace
+{
+constexpr char MAGIC[8] = {'P', 'I', 'A', 'A', 'C', 'S', 'R', '\0'};
+constexpr std::uint32_t VERSION = 1;
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+constexpr std::uint32_t FLAG_UNDIRECTED = 1;
+
+struct Header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint32_t flags;
+    std::uint32_t weightType;
+    std::uint64_t vertexCount;
+    std::uint64_t edgeCount;
+    std::uint64_t payloadChecksum;
+    std::uint64_t reserved;
+    std::uint64_t headerChecksum; // po wszystkich wczesniejszych polach
+};
+static_assert(sizeof(Header) == 64, "CSR file header must be 64 bytes");
+
+constexpr std::size_t padded(std::size_t bytes)
+{
+    return (bytes + 7) & ~std::size_t{7};
+}
+
+// FNV-1a po slowach 64-bitowych; ostatnie niepelne slowo jest uzupelniane zerami
+std::uint64_t checksum(std::uint64_t hash, const void* data, std::size_t size)
+{
+    constexpr std::uint64_t PRIME = 0x100000001b3ull;
+    const char* bytes = static_cast<const char*>(data);
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, 8);
+        hash = (hash ^ word) * PRIME;
+    }
+    if(i < size)
+    {
+        std::uint64_t word = 0;
+        std::memcpy(&word, bytes + i, size - i);
+        hash = (hash ^ word) * PRIME;
+    }
+    return hash;
+}
+
+constexpr std::uint64_t CHECKSUM_SEED = 0xcbf29ce484222325ull;
+
+[[noreturn]] void throwInvalid(const std::filesystem::path& path, const char* reason)
+{
+    throw std::runtime_error("Invalid CSR file " + path.string() + ": " + reason);
+}
+
+// Rozmiary tablic indeksow w kolejnosci zapisu (w elementach); zwraca ich laczny rozmiar w bajtach.
+// Za nimi w pliku leza wagi.
+std::size_t arraySizes(std::size_t n, std::size_t m, std::size_t (&sizes)[8])
+{
+    std::size_t counts[8] = {n, n + 1, m, m, n + 1, m, m, m};
+    std::size_t total = 0;
+    for(int i = 0; i < 8; ++i)
+    {
+        sizes[i] = counts[i];
+        total += padded(counts[i] * sizeof(int));
+    }
+    return total;
+}
+} // namespace
+
+// Złożoność czasowa: O(V + E), pamięciowa: O(1) poza buforem strumienia
+template <typename W>
+void saveCsrBinary(const BasicCsrGraph<W>& graph, const std::filesystem::path& path)
+{
+    auto arrays = graph.arrays();
+    Span<const int> intArrays[8] = {arrays.vertexIds, arrays.outOffsets, arrays.outTargets,  arrays.outEdgeIds,
+                                    arrays.inOffsets, arrays.inSlots,    arrays.edgeSources, arrays.edgeSlots};
+
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    if(!os)
+        throw std::runtime_error("Cannot write file: " + path.string());
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.flags = graph.isDirected() ? 0 : FLAG_UNDIRECTED;
+    header.weightType = weightTypeCode<W>();
+    header.vertexCount = static_cast<std::uint64_t>(graph.numVertices());
+    header.edgeCount = static_cast<std::uint64_t>(graph.numEdges());
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header)); // naglowek nadpisywany na koncu
+
+    static const char zeros[8] = {};
+    std::uint64_t hash = CHECKSUM_SEED;
+    auto writeArray = [&](const void* data, std::size_t bytes) {
+        os.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        os.write(zeros, static_cast<std::streamsize>(padded(bytes) - bytes));
+        hash = checksum(hash, data, bytes);
+    };
+    for(const auto& array : intArrays)
+    {
+        writeArray(array.data(), array.size() * sizeof(int));
+    }
+    writeArray(arrays.outWeights.data(), arrays.outWeights.size() * sizeof(W));
+
+    header.payloadChecksum = hash;
+    header.headerChecksum = checksum(CHECKSUM_SEED, &header, offsetof(Header, headerChecksum));
+    os.seekp(0);
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if(!os.flush())
+        throw std::runtime_error("Cannot write file: " + path.string());
+}
+
+// Złożoność czasowa: O(1) + O(V) dla niekolejnych identyfikatorow, O(rozmiar pliku) przy sprawdzaniu sumy
+template <typename W>
+std::unique_ptr<BasicCsrGraph<W>> loadCsrBinary(const std::filesystem::path& path, bool verifyChecksum)
+{
+    // Suma kontrolna i fromArrays czytaja plik po kolei, ale algorytmy na gotowym grafie juz nie
+    auto file = std::make_shared<MappedFile>(path, MappedFile::AccessPattern::Normal);
+    if(file->size() < sizeof(Header))
+        throwInvalid(path, "file too short");
+
+    Header header;
+    std::memcpy(&header, file->data(), sizeof(header));
+    if(std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+        throwInvalid(path, "not a CSR graph file");
+    if(header.headerChecksum != checksum(CHECKSUM_SEED, &header, offsetof(Header, headerChecksum)))
+        throwInvalid(path, "header checksum mismatch");
+    if(header.version != VERSION)
+        throwInvalid(path, "unsupported version");
+    if(header.byteOrder != BYTE_ORDER_MARK)
+        throwInvalid(path, "byte order mismatch");
+    if(header.weightType != weightTypeCode<W>())
+        throwInvalid(path, "weight type mismatch");
+    if(header.vertexCount >= static_cast<std::uint64_t>(std::numeric_limits<int>::max()) ||
+       header.edgeCount > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+        throwInvalid(path, "graph too large");
+
+    std::size_t n = header.vertexCount, m = header.edgeCount;
+    std::size_t sizes[8];
+    std::size_t payload = arraySizes(n, m, sizes) + padded(m * sizeof(W));
+    if(file->size() != sizeof(Header) + payload)
+        throwInvalid(path, "file size does not match header");
+
+    const char* data = file->data() + sizeof(Header);
+    if(verifyChecksum && checksum(CHECKSUM_SEED, data, payload) != header.payloadChecksum)
+        throwInvalid(path, "data checksum mismatch");
+
+    // Odwzorowanie zaczyna sie na granicy strony, a kazda tablica na granicy 8 bajtow
+    Span<const int> intArrays[8];
+    for(int i = 0; i < 8; ++i)
+    {
+        intArrays[i] = Span<const int>(reinterpret_cast<const int*>(data), sizes[i]);
+        data += padded(sizes[i] * sizeof(int));
+    }
+
+    typename BasicCsrGraph<W>::Arrays arrays{intArrays[0], intArrays[1], intArrays[2],
+                                             Span<const W>(reinterpret_cast<const W*>(data), m),
+                                             intArrays[3], intArrays[4], intArrays[5], intArrays[6], intArrays[7]};
+    try
+    {
+        return BasicCsrGraph<W>::fromArrays(arrays, std::move(file), (header.flags & FLAG_UNDIRECTED) == 0);
+    }
+    catch(const std::invalid_argument& error)
+    {
+        throwInvalid(path, error.what());
+    }
+}
+
+template <typename W>
+void convertTextToCsrBinary(const std::filesystem::path& textPath, const std::filesystem::path& binaryPath,
+                            EdgeDirection direction)
+{
+    auto graph = BasicCsrGraph<W>::createGraph(loadEdgeList<W>(textPath), direction);
+    std::unique_ptr<BasicCsrGraph<W>> storage;
+    saveCsrBinary(asCsr(*graph, storage), binaryPath);
+}
+
+#define GRAPHS_INSTANTIATE_CSR_BINARY(W)                                                                               \
+    template void saveCsrBinary(const BasicCsrGraph<W>&, const std::filesystem::path&);                                \
+    template std::unique_ptr<BasicCsrGraph<W>> loadCsrBinary(const std::filesystem::path&, bool);                     \
+    template void convertTextToCsrBinary<W>(const std::filesystem::path&, const std::filesystem::path&, EdgeDirection);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_CSR_BINARY)
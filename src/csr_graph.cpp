@@ -0,0 +1,653 @@
+#include "graphs/csr_graph.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include "graphs/compressed_graph.hpp"
+#include "graphs/parallel.hpp"
+#include "graphs/succinct_graph.hpp"
+
+namespace
+{
+// Tablice grafu CSR zbudowanego w pamieci; widoki grafu wskazuja na nie
+template <typename W>
+struct OwnedArrays
+{
+    std::vector<int> vertexIds, outOffsets, outTargets, outEdgeIds, inOffsets, inSlots, edgeSources, edgeSlots;
+    std::vector<W> outWeights;
+};
+
+// Stabilne sortowanie przez zliczanie krawedzi 0..m-1 po kluczu keys[e] z zakresu 0..n-1,
+// rownolegle na threadCount zakresach krawedzi. Wypelnia offsets (n + 1) i wywoluje place(e, pozycja);
+// w obrebie klucza pozycje rosna z e (najpierw krawedzie watku 0, potem 1, ...), jak w wersji sekwencyjnej.
+// Złożoność czasowa: O(m / threadCount + n * threadCount), pamięciowa: O(n * threadCount)
+template <typename Place>
+void countingSort(const std::vector<int>& keys, int n, int threadCount, std::vector<int>& offsets, Place place)
+{
+    std::size_t m = keys.size();
+    std::vector<std::vector<int>> next(threadCount, std::vector<int>(n, 0));
+    parallelFor(threadCount, [&](int t) {
+        auto [begin, end] = chunkRange(m, t, threadCount);
+        for(std::size_t e = begin; e < end; ++e)
+        {
+            ++next[t][keys[e]];
+        }
+    });
+
+    offsets.assign(n + 1, 0);
+    int position = 0;
+    for(int key = 0; key < n; ++key)
+    {
+        offsets[key] = position;
+        for(int t = 0; t < threadCount; ++t)
+        {
+            int count = next[t][key];
+            next[t][key] = position;
+            position += count;
+        }
+    }
+    offsets[n] = position;
+
+    parallelFor(threadCount, [&](int t) {
+        auto [begin, end] = chunkRange(m, t, threadCount);
+        for(std::size_t e = begin; e < end; ++e)
+        {
+            place(static_cast<int>(e), next[t][keys[e]]++);
+        }
+    });
+}
+} // namespace
+
+// Buduje strukture CSR z krawedzi podanych w kolejnosci identyfikatorow.
+// sources / targets to gesto numerowane indeksy wierzcholkow, ids[i] to identyfikator
+// wierzcholka o indeksie i. Krawedzie sa sortowane po poczatku sortowaniem przez zliczanie
+// (stabilnym, wiec w obrebie wierzcholka zachowuja kolejnosc identyfikatorow).
+// Złożoność czasowa: O(V + E), pamięciowa: O(V + E)
+template <typename W>
+std::unique_ptr<BasicCsrGraph<W>> BasicCsrGraph<W>::build(std::vector<int> ids, const std::vector<int>& sources,
+                                                          const std::vector<int>& targets,
+                                                          const std::vector<W>& weights, int threadCount)
+{
+    auto owned = std::make_shared<OwnedArrays<W>>();
+    int n = static_cast<int>(ids.size());
+    int m = static_cast<int>(sources.size());
+
+    // Watek dostaje co najmniej 64K krawedzi, a liczniki watkow (n na watek) nie moga przerosnac tablic krawedzi
+    threadCount = std::min({resolveThreadCount(threadCount), m / 65536 + 1, static_cast<int>(4LL * m / (n + 1)) + 1});
+
+    owned->vertexIds = std::move(ids);
+    owned->outTargets.resize(m);
+    owned->outWeights.resize(m);
+    owned->outEdgeIds.resize(m);
+    owned->edgeSlots.resize(m);
+    owned->edgeSources = sources;
+    countingSort(sources, n, threadCount, owned->outOffsets, [&owned, &targets, &weights](int e, int slot) {
+        owned->outTargets[slot] = targets[e];
+        owned->outWeights[slot] = weights[e];
+        owned->outEdgeIds[slot] = e;
+        owned->edgeSlots[e] = slot;
+    });
+
+    owned->inSlots.resize(m);
+    countingSort(targets, n, threadCount, owned->inOffsets,
+                 [&owned](int e, int position) { owned->inSlots[position] = owned->edgeSlots[e]; });
+
+    Arrays arrays{owned->vertexIds, owned->outOffsets, owned->outTargets,  owned->outWeights, owned->outEdgeIds,
+                  owned->inOffsets, owned->inSlots,    owned->edgeSources, owned->edgeSlots};
+    return wrapArrays(arrays, std::move(owned), true);
+}
+
+// Złożoność czasowa: O(V + E), pamięciowa: O(V), gdy identyfikatory wierzcholkow nie sa kolejnymi indeksami
+template <typename W>
+std::unique_ptr<BasicCsrGraph<W>> BasicCsrGraph<W>::fromArrays(const Arrays& arrays, std::shared_ptr<const void> owner,
+                                                               bool directed)
+{
+    std::size_t n = arrays.vertexIds.size();
+    std::size_t m = arrays.outTargets.size();
+    if(arrays.outOffsets.size() != n + 1 || arrays.inOffsets.size() != n + 1 || arrays.outWeights.size() != m ||
+       arrays.outEdgeIds.size() != m || arrays.inSlots.size() != m || arrays.edgeSources.size() != m ||
+       arrays.edgeSlots.size() != m)
+    {
+        throw std::invalid_argument("Inconsistent CSR array sizes");
+    }
+    if(arrays.outOffsets[0] != 0 || arrays.inOffsets[0] != 0 || arrays.outOffsets[n] != static_cast<int>(m) ||
+       arrays.inOffsets[n] != static_cast<int>(m))
+    {
+        throw std::invalid_argument("Invalid CSR offsets");
+    }
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(arrays.outOffsets[i] > arrays.outOffsets[i + 1] || arrays.inOffsets[i] > arrays.inOffsets[i + 1])
+        {
+            throw std::invalid_argument("Invalid CSR offsets");
+        }
+    }
+
+    // Kazdy indeks musi trafiac w tablice, a slot i identyfikator krawedzi musza sie nawzajem wskazywac,
+    // zeby uszkodzone dane (np. plik wczytany bez sumy kontrolnej) nie prowadzily do czytania poza tablicami
+    auto outside = [](int value, std::size_t limit) {
+        return value < 0 || static_cast<std::size_t>(value) >= limit;
+    };
+    for(std::size_t slot = 0; slot < m; ++slot)
+    {
+        if(outside(arrays.outTargets[slot], n) || outside(arrays.outEdgeIds[slot], m))
+        {
+            throw std::invalid_argument("Invalid CSR edge data");
+        }
+    }
+    for(std::size_t e = 0; e < m; ++e)
+    {
+        int slot = arrays.edgeSlots[e];
+        int source = arrays.edgeSources[e];
+        if(outside(slot, m) || outside(source, n) || arrays.outEdgeIds[slot] != static_cast<int>(e) ||
+           slot < arrays.outOffsets[source] || slot >= arrays.outOffsets[source + 1])
+        {
+            throw std::invalid_argument("Invalid CSR edge data");
+        }
+    }
+    for(std::size_t v = 0; v < n; ++v)
+    {
+        for(int i = arrays.inOffsets[v]; i < arrays.inOffsets[v + 1]; ++i)
+        {
+            if(outside(arrays.inSlots[i], m) || arrays.outTargets[arrays.inSlots[i]] != static_cast<int>(v))
+            {
+                throw std::invalid_argument("Invalid CSR edge data");
+            }
+        }
+    }
+    return wrapArrays(arrays, std::move(owner), directed);
+}
+
+// Złożoność czasowa i pamięciowa: O(1), a O(V), gdy identyfikatory wierzcholkow nie sa kolejnymi indeksami
+template <typename W>
+std::unique_ptr<BasicCsrGraph<W>> BasicCsrGraph<W>::wrapArrays(const Arrays& arrays, std::shared_ptr<const void> owner,
+                                                               bool directed)
+{
+    std::size_t n = arrays.vertexIds.size();
+    auto graph = std::make_unique<BasicCsrGraph<W>>();
+    graph->vertexCount = static_cast<int>(n);
+    graph->edgeCount = static_cast<int>(arrays.outTargets.size());
+    graph->directed = directed;
+    graph->owner = std::move(owner);
+
+    graph->vertexIds = arrays.vertexIds;
+    graph->outOffsets = arrays.outOffsets;
+    graph->outTargets = arrays.outTargets;
+    graph->outWeights = arrays.outWeights;
+    graph->outEdgeIds = arrays.outEdgeIds;
+    graph->inOffsets = arrays.inOffsets;
+    graph->inSlots = arrays.inSlots;
+    graph->edgeSources = arrays.edgeSources;
+    graph->edgeSlots = arrays.edgeSlots;
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        if(arrays.vertexIds[i] != static_cast<int>(i))
+        {
+            for(std::size_t j = 0; j < n; ++j)
+            {
+                graph->vertexIndices[arrays.vertexIds[j]] = static_cast<int>(j);
+            }
+            if(graph->vertexIndices.size() != n)
+            {
+                throw std::invalid_argument("Duplicate CSR vertex ids");
+            }
+            break;
+        }
+    }
+    return graph;
+}
+
+template <typename W>
+typename BasicCsrGraph<W>::Arrays BasicCsrGraph<W>::arrays() const
+{
+    return {vertexIds, outOffsets, outTargets, outWeights, outEdgeIds, inOffsets, inSlots, edgeSources, edgeSlots};
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+std::size_t BasicCsrGraph<W>::memoryUsage() const
+{
+    std::size_t ints = vertexIds.size() + outOffsets.size() + outTargets.size() + outEdgeIds.size() + inOffsets.size() +
+                       inSlots.size() + edgeSources.size() + edgeSlots.size() + vertexIndices.size() * 2;
+    return ints * sizeof(int) + outWeights.size() * sizeof(W);
+}
+
+// Tworzy kopie CSR dowolnego grafu.
+// Wierzcholki sa porzadkowane rosnaco po identyfikatorze, krawedzie po identyfikatorze
+// zrodlowego grafu i numerowane od nowa 0..m-1. Bez usuwania to kolejnosc wstawiania; krawedz w ponownie
+// uzytym slocie ma identyfikator z wyzsza generacja, wiec trafia za wszystkie krawedzie pierwszej generacji.
+// Złożoność czasowa: O(V log V + E log E) przez sortowanie identyfikatorow, pamięciowa: O(V + E)
+template <typename W>
+std::unique_ptr<BasicCsrGraph<W>> BasicCsrGraph<W>::fromGraph(const BasicGraph<W>& graph)
+{
+    std::vector<int> ids = graph.showVertices();
+    std::sort(ids.begin(), ids.end());
+
+    std::unordered_map<int, int> indices;
+    indices.reserve(ids.size());
+    for(int i = 0; i < static_cast<int>(ids.size()); ++i)
+    {
+        indices[ids[i]] = i;
+    }
+
+    // Krawedzie zbierane przez forEachEdge (bez alokacji na krawedz) i porzadkowane po identyfikatorze
+    struct InputEdge
+    {
+        int id, source, target;
+        W weight;
+    };
+    std::vector<InputEdge> input;
+    input.reserve(graph.numEdges());
+    graph.forEachEdge([&input, &indices](int e, int v1, int v2, W weight) {
+        input.push_back({e, indices.at(v1), indices.at(v2), weight});
+    });
+    std::sort(input.begin(), input.end(), [](const InputEdge& a, const InputEdge& b) { return a.id < b.id; });
+
+    std::vector<int> sources(input.size()), targets(input.size());
+    std::vector<W> weights(input.size());
+    for(std::size_t i = 0; i < input.size(); ++i)
+    {
+        sources[i] = input[i].source;
+        targets[i] = input[i].target;
+        weights[i] = input[i].weight;
+    }
+
+    auto csr = build(std::move(ids), sources, targets, weights);
+    csr->directed = graph.isDirected();
+    return csr;
+}
+
+// Tworzy graf na podstawie danych wejściowych ze strumienia is (format "V E", potem E linii "v1 v2 waga").
+// W trybie Undirected drugi zapis krawedzi (v2, v1, w) jest pomijany.
+// Złożoność czasowa: O(V + E), pamięciowa: O(V + E)
+template <typename W>
+std::unique_ptr<BasicGraph<W>> BasicCsrGraph<W>::createGraph(std::istream& is, EdgeDirection direction)
+{
+    int vertexCount, edgeCount;
+    is >> vertexCount >> edgeCount;
+    if(!is || vertexCount < 0 || edgeCount < 0)
+    {
+        throw std::invalid_argument("Invalid input format");
+    }
+
+    BasicEdgeList<W> edgeList;
+    edgeList.vertexCount = vertexCount;
+    edgeList.edges.resize(edgeCount);
+    for(auto& edge : edgeList.edges)
+    {
+        is >> edge.v1 >> edge.v2;
+        edge.weight = readWeight<W>(is);
+        if(!is)
+        {
+            throw std::invalid_argument("Invalid edge format");
+        }
+    }
+
+    return createGraph(edgeList, direction);
+}
+
+// Buduje graf CSR bezposrednio z listy krawedzi, bez wstawiania pojedynczych krawedzi.
+// Złożoność czasowa: O(V + E), pamięciowa: O(V + E)
+template <typename W>
+std::unique_ptr<BasicGraph<W>> BasicCsrGraph<W>::createGraph(const BasicEdgeList<W>& edgeList, EdgeDirection direction,
+                                                             int threadCount)
+{
+    int vertexCount = edgeList.vertexCount;
+    if(vertexCount < 0)
+    {
+        throw std::invalid_argument("Invalid input format");
+    }
+
+    std::vector<typename BasicGraph<W>::EdgeInput> collapsed;
+    if(direction == EdgeDirection::Undirected)
+    {
+        collapsed = edgeList.edges;
+        collapseReciprocalEdges(collapsed);
+    }
+    const auto& input = direction == EdgeDirection::Undirected ? collapsed : edgeList.edges;
+
+    // Rozdzielenie na tablice poczatkow, koncow i wag razem ze sprawdzeniem wierzcholkow
+    std::vector<int> sources(input.size()), targets(input.size());
+    std::vector<W> weights(input.size());
+    int splitThreads = std::min(resolveThreadCount(threadCount), static_cast<int>(input.size() / 65536) + 1);
+    parallelFor(splitThreads, [&](int t) {
+        auto [begin, end] = chunkRange(input.size(), t, splitThreads);
+        for(std::size_t e = begin; e < end; ++e)
+        {
+            const auto& edge = input[e];
+            if(edge.v1 < 0 || edge.v1 >= vertexCount || edge.v2 < 0 || edge.v2 >= vertexCount)
+            {
+                throw std::runtime_error("Vertex does not exist");
+            }
+            sources[e] = edge.v1;
+            targets[e] = edge.v2;
+            weights[e] = edge.weight;
+        }
+    });
+
+    std::vector<int> ids(vertexCount);
+    for(int i = 0; i < vertexCount; ++i)
+    {
+        ids[i] = i;
+    }
+    auto graph = build(std::move(ids), sources, targets, weights, threadCount);
+    graph->directed = direction == EdgeDirection::Directed;
+    return graph;
+}
+
+template <typename W>
+const BasicCsrGraph<W>& asCsr(const BasicGraph<W>& graph, std::unique_ptr<BasicCsrGraph<W>>& storage)
+{
+    if(auto* csr = dynamic_cast<const BasicCsrGraph<W>*>(&graph))
+    {
+        return *csr;
+    }
+    if(dynamic_cast<const BasicCompressedGraph<W>*>(&graph) || dynamic_cast<const BasicSuccinctGraph<W>*>(&graph))
+    {
+        throw std::invalid_argument("Compressed graphs are not copied to CSR");
+    }
+    storage = BasicCsrGraph<W>::fromGraph(graph);
+    return *storage;
+}
+
+// Zwraca gesty indeks wierzcholka v.
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+int BasicCsrGraph<W>::indexOf(int v) const
+{
+    if(vertexIndices.empty())
+    {
+        if(v < 0 || v >= vertexCount)
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        return v;
+    }
+
+    auto it = vertexIndices.find(v);
+    if(it == vertexIndices.end())
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    return it->second;
+}
+
+template <typename W>
+int BasicCsrGraph<W>::edgeSlot(int e) const
+{
+    if(e < 0 || e >= edgeCount)
+    {
+        throw std::runtime_error("Edge does not exist");
+    }
+    return edgeSlots[e];
+}
+
+// metody uaktualniajace - graf CSR jest tylko do odczytu
+
+template <typename W>
+int BasicCsrGraph<W>::insertVertex(int)
+{
+    throw std::logic_error("CsrGraph is read-only");
+}
+
+template <typename W>
+int BasicCsrGraph<W>::insertEdge(int, int, W)
+{
+    throw std::logic_error("CsrGraph is read-only");
+}
+
+template <typename W>
+void BasicCsrGraph<W>::removeVertex(int)
+{
+    throw std::logic_error("CsrGraph is read-only");
+}
+
+template <typename W>
+void BasicCsrGraph<W>::removeEdge(int)
+{
+    throw std::logic_error("CsrGraph is read-only");
+}
+
+template <typename W>
+int BasicCsrGraph<W>::insertVertices(int)
+{
+    throw std::logic_error("CsrGraph is read-only");
+}
+
+template <typename W>
+int BasicCsrGraph<W>::insertEdges(Span<const typename BasicGraph<W>::EdgeInput>)
+{
+    throw std::logic_error("CsrGraph is read-only");
+}
+
+template <typename W>
+void BasicCsrGraph<W>::replaceVertices(int, int)
+{
+    throw std::logic_error("CsrGraph is read-only");
+}
+
+template <typename W>
+void BasicCsrGraph<W>::replaceEdges(int, W)
+{
+    throw std::logic_error("CsrGraph is read-only");
+}
+
+// metody iterujace
+
+// Złożoność czasowa: O(V), pamięciowa: O(V)
+template <typename W>
+std::vector<int> BasicCsrGraph<W>::showVertices() const
+{
+    return std::vector<int>(vertexIds.begin(), vertexIds.end());
+}
+
+// Złożoność czasowa: O(E), pamięciowa: O(E)
+template <typename W>
+std::vector<int> BasicCsrGraph<W>::showEdges() const
+{
+    std::vector<int> result(edgeCount);
+    for(int e = 0; e < edgeCount; ++e)
+    {
+        result[e] = e;
+    }
+    return result;
+}
+
+// Zwraca krawedzie wychodzace, a potem wchodzace do v (petla wlasna tylko raz).
+// Złożoność czasowa: O(d), pamięciowa: O(d)
+template <typename W>
+std::vector<int> BasicCsrGraph<W>::incidentEdges(int v) const
+{
+    int u = indexOf(v);
+
+    std::vector<int> result;
+    result.reserve(outEnd(u) - outBegin(u) + inEnd(u) - inBegin(u));
+    for(int slot = outBegin(u); slot < outEnd(u); ++slot)
+    {
+        result.push_back(outEdgeIds[slot]);
+    }
+    for(int i = inBegin(u); i < inEnd(u); ++i)
+    {
+        int slot = inSlots[i];
+        if(source(slot) != u)
+            result.push_back(outEdgeIds[slot]);
+    }
+    return result;
+}
+
+// W grafie nieskierowanym krawedzie wychodzace i wchodzace to krawedzie incydentne.
+// Złożoność czasowa: O(d_out), pamięciowa: O(d_out)
+template <typename W>
+std::vector<int> BasicCsrGraph<W>::outEdges(int v) const
+{
+    if(!directed)
+    {
+        return incidentEdges(v);
+    }
+    int u = indexOf(v);
+    return std::vector<int>(outEdgeIds.begin() + outBegin(u), outEdgeIds.begin() + outEnd(u));
+}
+
+// Złożoność czasowa: O(d_in), pamięciowa: O(d_in)
+template <typename W>
+std::vector<int> BasicCsrGraph<W>::inEdges(int v) const
+{
+    if(!directed)
+    {
+        return incidentEdges(v);
+    }
+    int u = indexOf(v);
+
+    std::vector<int> result;
+    result.reserve(inEnd(u) - inBegin(u));
+    for(int i = inBegin(u); i < inEnd(u); ++i)
+    {
+        result.push_back(outEdgeIds[inSlots[i]]);
+    }
+    return result;
+}
+
+// metody dostepu
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+std::vector<int> BasicCsrGraph<W>::endVertices(int edge) const
+{
+    int slot = edgeSlot(edge);
+    return {vertexIds[edgeSources[edge]], vertexIds[outTargets[slot]]};
+}
+
+// Przeszukuje krawedzie wychodzace z v1, a w grafie nieskierowanym rowniez wchodzace.
+// Złożoność czasowa: O(d1), pamięciowa: O(1)
+template <typename W>
+bool BasicCsrGraph<W>::areAdjacent(int v1, int v2) const
+{
+    int u = indexOf(v1);
+    int w = indexOf(v2);
+    for(int slot = outBegin(u); slot < outEnd(u); ++slot)
+    {
+        if(outTargets[slot] == w)
+            return true;
+    }
+    if(!directed)
+    {
+        for(int i = inBegin(u); i < inEnd(u); ++i)
+        {
+            if(source(inSlots[i]) == w)
+                return true;
+        }
+    }
+    return false;
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+int BasicCsrGraph<W>::opposite(int v, int e) const
+{
+    std::vector<int> ends = endVertices(e);
+    if(ends[0] == v)
+        return ends[1];
+    else if(ends[1] == v)
+        return ends[0];
+
+    throw std::runtime_error("Vertex does not belong to the edge");
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+W BasicCsrGraph<W>::edgeWeight(int e) const
+{
+    return outWeights[edgeSlot(e)];
+}
+
+// metody bez alokacji
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+std::pair<int, int> BasicCsrGraph<W>::endpoints(int e) const
+{
+    int slot = edgeSlot(e);
+    return {vertexIds[edgeSources[e]], vertexIds[outTargets[slot]]};
+}
+
+// Złożoność czasowa: O(V), pamięciowa: O(1)
+template <typename W>
+void BasicCsrGraph<W>::forEachVertex(FunctionRef<void(int v)> visit) const
+{
+    for(int id : vertexIds)
+    {
+        visit(id);
+    }
+}
+
+// Krawędzie w kolejności identyfikatorów.
+// Złożoność czasowa: O(E), pamięciowa: O(1)
+template <typename W>
+void BasicCsrGraph<W>::forEachEdge(typename BasicGraph<W>::EdgeVisitor visit) const
+{
+    for(int e = 0; e < edgeCount; ++e)
+    {
+        int slot = edgeSlots[e];
+        visit(e, vertexIds[edgeSources[e]], vertexIds[outTargets[slot]], outWeights[slot]);
+    }
+}
+
+// W grafie nieskierowanym odwiedza rowniez krawedzie wchodzace (petle wlasna raz).
+// Złożoność czasowa: O(d_out), pamięciowa: O(1)
+template <typename W>
+void BasicCsrGraph<W>::forEachOutNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const
+{
+    int u = indexOf(v);
+    for(int slot = outBegin(u); slot < outEnd(u); ++slot)
+    {
+        visit(vertexIds[outTargets[slot]], outEdgeIds[slot], outWeights[slot]);
+    }
+    if(!directed)
+    {
+        for(int i = inBegin(u); i < inEnd(u); ++i)
+        {
+            int slot = inSlots[i];
+            if(source(slot) != u)
+                visit(vertexIds[source(slot)], outEdgeIds[slot], outWeights[slot]);
+        }
+    }
+}
+
+// W grafie nieskierowanym to samo co forEachOutNeighbor.
+// Złożoność czasowa: O(d_in), pamięciowa: O(1)
+template <typename W>
+void BasicCsrGraph<W>::forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const
+{
+    if(!directed)
+    {
+        forEachOutNeighbor(v, visit);
+        return;
+    }
+    int u = indexOf(v);
+    for(int i = inBegin(u); i < inEnd(u); ++i)
+    {
+        int slot = inSlots[i];
+        visit(vertexIds[source(slot)], outEdgeIds[slot], outWeights[slot]);
+    }
+}
+
+template <typename W>
+void BasicCsrGraph<W>::printGraph() const
+{
+    std::cout << "\n=== REPREZENTACJA GRAFU (CSR) ===\n";
+    std::cout << vertexCount << " " << edgeCount << std::endl;
+
+    for(int u = 0; u < vertexCount; ++u)
+    {
+        std::cout << "  " << vertexIds[u] << ": ";
+        for(int slot = outBegin(u); slot < outEnd(u); ++slot)
+        {
+            std::cout << vertexIds[outTargets[slot]] << "(" << printableWeight(outWeights[slot]) << ", " << outEdgeIds[slot] << ") ";
+        }
+        std::cout << "\n";
+    }
+}
+
+#define GRAPHS_INSTANTIATE_CSR_GRAPH(W)                                                                                \
+    template class BasicCsrGraph<W>;                                                                                   \
+    template const BasicCsrGraph<W>& asCsr(const BasicGraph<W>&, std::unique_ptr<BasicCsrGraph<W>>&);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_CSR_GRAPH)
@@ -0,0 +1,205 @@
+#include "graphs/edge_list.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include "graphs/mapped_file.hpp"
+#include "graphs/parallel.hpp"
+#include "graphs/text_cursor.hpp"
+
+namespace
+{
+// Wynik parsowania jednego fragmentu pliku przez jeden watek. Numery linii sa wzgledne
+// (0 - linia, w ktorej fragment sie zaczyna); bledy sa zapamietywane, a nie rzucane, bo
+// bezwzgledny numer linii znany jest dopiero po policzeniu linii we wczesniejszych fragmentach.
+template <typename W>
+struct Chunk
+{
+    std::vector<typename BasicGraph<W>::EdgeInput> edges;
+    std::optional<int> source;
+    int newlines = 0;
+    int firstDataLine = -1;
+    int errorLine = -1;
+    std::string error;
+};
+
+// Parsuje linie fragmentu [begin, end): 3 liczby to krawedz, 1 liczba to wierzcholek startowy
+// (poprawny tylko w ostatniej niepustej linii pliku, co sprawdza scalanie), pusta linia jest pomijana.
+template <typename W>
+void parseChunk(const char* begin, const char* end, int vertexCount, Chunk<W>& chunk)
+{
+    auto isBlank = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+    auto fail = [&chunk](std::string message) {
+        chunk.errorLine = chunk.newlines;
+        chunk.error = std::move(message);
+    };
+
+    for(const char* line = begin; line < end; ++chunk.newlines)
+    {
+        const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+        if(lineEnd == nullptr)
+            lineEnd = end;
+
+        int vertices[2];
+        W weight{};
+        int tokens = 0;
+        for(const char* pos = line;;)
+        {
+            while(pos != lineEnd && isBlank(*pos))
+                ++pos;
+            if(pos == lineEnd)
+                break;
+            if(tokens == 3)
+                return fail("too many values in line");
+
+            const char* what = tokens < 2 ? "vertex" : "edge weight";
+            std::from_chars_result parsed = tokens < 2 ? std::from_chars(pos, lineEnd, vertices[tokens])
+                                                       : std::from_chars(pos, lineEnd, weight);
+            if(parsed.ec == std::errc::result_out_of_range)
+                return fail(std::string(what) + " out of range");
+            if(parsed.ec != std::errc() || (parsed.ptr != lineEnd && !isBlank(*parsed.ptr)))
+                return fail(std::string("invalid ") + what);
+            if(tokens < 2 && (vertices[tokens] < 0 || vertices[tokens] >= vertexCount))
+                return fail("vertex " + std::to_string(vertices[tokens]) + " does not exist");
+
+            pos = parsed.ptr;
+            ++tokens;
+        }
+
+        if(tokens > 0)
+        {
+            if(chunk.source)
+                return fail("unexpected data after source vertex");
+            if(tokens == 2)
+                return fail("expected \"v1 v2 weight\"");
+            if(chunk.firstDataLine < 0)
+                chunk.firstDataLine = chunk.newlines;
+
+            if(tokens == 3)
+                chunk.edges.push_back({vertices[0], vertices[1], weight});
+            else
+                chunk.source = vertices[0];
+        }
+
+        if(lineEnd == end)
+            break;
+        line = lineEnd + 1;
+    }
+}
+} // namespace
+
+// Złożoność czasowa: O(rozmiar wejscia), pamięciowa: O(E)
+template <typename W>
+BasicEdgeList<W> parseEdgeList(const char* begin, const char* end)
+{
+    TextCursor cursor(begin, end);
+    BasicEdgeList<W> result;
+
+    result.vertexCount = cursor.read<int>("vertex count");
+    int edgeCount = cursor.read<int>("edge count");
+    if(result.vertexCount < 0)
+        throw ParseError(cursor.line(), "negative vertex count");
+    if(edgeCount < 0)
+        throw ParseError(cursor.line(), "negative edge count");
+
+    // Linia krawedzi ma co najmniej 6 znakow, wiec zawyzone E nie wymusi ogromnej rezerwacji
+    result.edges.reserve(std::min<std::size_t>(edgeCount, static_cast<std::size_t>(end - begin) / 6 + 1));
+    for(int e = 0; e < edgeCount; ++e)
+    {
+        typename BasicGraph<W>::EdgeInput edge;
+        edge.v1 = cursor.readVertex(result.vertexCount, "start vertex");
+        edge.v2 = cursor.readVertex(result.vertexCount, "end vertex");
+        edge.weight = cursor.read<W>("edge weight");
+        result.edges.push_back(edge);
+    }
+
+    if(!cursor.atEnd())
+    {
+        result.source = cursor.readVertex(result.vertexCount, "source vertex");
+        if(!cursor.atEnd())
+            throw ParseError(cursor.line(), "unexpected data after source vertex");
+    }
+    return result;
+}
+
+template <typename W>
+BasicEdgeList<W> loadEdgeList(const std::filesystem::path& path)
+{
+    MappedFile file(path);
+    return parseEdgeList<W>(file.begin(), file.end());
+}
+
+// Złożoność czasowa: O(rozmiar wejscia / liczba watkow + liczba watkow), pamięciowa: O(E)
+template <typename W>
+BasicEdgeList<W> parseEdgeListParallel(const char* begin, const char* end, int threadCount)
+{
+    TextCursor cursor(begin, end);
+    BasicEdgeList<W> result;
+
+    result.vertexCount = cursor.read<int>("vertex count");
+    int edgeCount = cursor.read<int>("edge count");
+    if(result.vertexCount < 0)
+        throw ParseError(cursor.line(), "negative vertex count");
+    if(edgeCount < 0)
+        throw ParseError(cursor.line(), "negative edge count");
+    int headerLine = cursor.line();
+
+    // Fragmenty co najmniej 64 KB, granice przesuniete za najblizszy znak nowej linii
+    const char* body = cursor.position();
+    std::size_t bodySize = static_cast<std::size_t>(end - body);
+    int chunkCount = std::max(1, static_cast<int>(std::min<std::size_t>(resolveThreadCount(threadCount),
+                                                                        bodySize / (64 * 1024) + 1)));
+    std::vector<const char*> bounds(chunkCount + 1, end);
+    bounds[0] = body;
+    for(int t = 1; t < chunkCount; ++t)
+    {
+        const char* split = std::max(bounds[t - 1], body + chunkRange(bodySize, t, chunkCount).first);
+        const char* newline = static_cast<const char*>(std::memchr(split, '\n', end - split));
+        bounds[t] = newline == nullptr ? end : newline + 1;
+    }
+
+    std::vector<Chunk<W>> chunks(chunkCount);
+    parallelFor(chunkCount, [&](int t) {
+        chunks[t].edges.reserve(static_cast<std::size_t>(bounds[t + 1] - bounds[t]) / 8);
+        parseChunk(bounds[t], bounds[t + 1], result.vertexCount, chunks[t]);
+    });
+
+    // Bledy i wierzcholek startowy w kolejnosci pliku
+    std::vector<std::size_t> edgeOffsets(chunkCount + 1, 0);
+    int line = headerLine;
+    for(int t = 0; t < chunkCount; ++t)
+    {
+        const Chunk<W>& chunk = chunks[t];
+        if(chunk.errorLine >= 0)
+            throw ParseError(line + chunk.errorLine, chunk.error);
+        if(result.source && chunk.firstDataLine >= 0)
+            throw ParseError(line + chunk.firstDataLine, "unexpected data after source vertex");
+        if(chunk.source)
+            result.source = chunk.source;
+
+        edgeOffsets[t + 1] = edgeOffsets[t] + chunk.edges.size();
+        line += chunk.newlines;
+    }
+    if(edgeOffsets[chunkCount] != static_cast<std::size_t>(edgeCount))
+        throw ParseError(line, "expected " + std::to_string(edgeCount) + " edges, found " +
+                                   std::to_string(edgeOffsets[chunkCount]));
+
+    result.edges.resize(edgeOffsets[chunkCount]);
+    parallelFor(chunkCount, [&](int t) {
+        std::copy(chunks[t].edges.begin(), chunks[t].edges.end(), result.edges.begin() + edgeOffsets[t]);
+    });
+    return result;
+}
+
+template <typename W>
+BasicEdgeList<W> loadEdgeListParallel(const std::filesystem::path& path, int threadCount)
+{
+    MappedFile file(path);
+    return parseEdgeListParallel<W>(file.begin(), file.end(), threadCount);
+}
+
+#define GRAPHS_INSTANTIATE_EDGE_LIST(W)                                                                                \
+    template BasicEdgeList<W> parseEdgeList(const char*, const char*);                                                \
+    template BasicEdgeList<W> loadEdgeList(const std::filesystem::path&);                                             \
+    template BasicEdgeList<W> parseEdgeListParallel(const char*, const char*, int);                                   \
+    template BasicEdgeList<W> loadEdgeListParallel(const std::filesystem::path&, int);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_EDGE_LIST)
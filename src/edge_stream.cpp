@@ -0,0 +1,88 @@
+#include "graphs/edge_stream.hpp"
+#include <stdexcept>
+#include <utility>
+
+template <typename W>
+BasicIstreamEdgeStream<W>::BasicIstreamEdgeStream(std::istream& is) : is(is)
+{
+    if(!(is >> vertices >> remaining) || vertices < 0 || remaining < 0)
+        throw std::invalid_argument("Invalid edge stream header");
+}
+
+// Złożoność czasowa: O(rozmiar bufora), pamięciowa: O(1)
+template <typename W>
+std::size_t BasicIstreamEdgeStream<W>::read(Span<typename BasicEdgeStream<W>::EdgeInput> buffer)
+{
+    std::size_t count = 0;
+    for(; count < buffer.size() && remaining > 0; ++count, --remaining)
+    {
+        auto& edge = buffer[count];
+        is >> edge.v1 >> edge.v2;
+        edge.weight = readWeight<W>(is);
+        if(!is || edge.v1 < 0 || edge.v1 >= vertices || edge.v2 < 0 || edge.v2 >= vertices)
+            throw std::invalid_argument("Invalid edge in stream");
+    }
+    return count;
+}
+
+template <typename W>
+BasicMappedEdgeStream<W>::BasicMappedEdgeStream(const std::filesystem::path& path)
+    : file(path), cursor(file.begin(), file.end())
+{
+    vertices = cursor.read<int>("vertex count");
+    remaining = cursor.read<int>("edge count");
+    if(vertices < 0)
+        throw ParseError(cursor.line(), "negative vertex count");
+    if(remaining < 0)
+        throw ParseError(cursor.line(), "negative edge count");
+}
+
+// Złożoność czasowa: O(rozmiar bufora), pamięciowa: O(1)
+template <typename W>
+std::size_t BasicMappedEdgeStream<W>::read(Span<typename BasicEdgeStream<W>::EdgeInput> buffer)
+{
+    std::size_t count = 0;
+    for(; count < buffer.size() && remaining > 0; ++count, --remaining)
+    {
+        auto& edge = buffer[count];
+        edge.v1 = cursor.readVertex(vertices, "start vertex");
+        edge.v2 = cursor.readVertex(vertices, "end vertex");
+        edge.weight = cursor.read<W>("edge weight");
+    }
+    return count;
+}
+
+template <typename W>
+BasicGeneratorEdgeStream<W>::BasicGeneratorEdgeStream(int vertexCount, Generator next)
+    : vertices(vertexCount), next(std::move(next))
+{
+    if(vertexCount < 0)
+        throw std::invalid_argument("Negative vertex count");
+}
+
+// Konce kazdej wygenerowanej krawedzi sa sprawdzane wzgledem vertexCount (std::out_of_range).
+// Złożoność czasowa: O(rozmiar bufora) wywolan generatora
+template <typename W>
+std::size_t BasicGeneratorEdgeStream<W>::read(Span<typename BasicEdgeStream<W>::EdgeInput> buffer)
+{
+    std::size_t count = 0;
+    while(!finished && count < buffer.size())
+    {
+        if(next(buffer[count]))
+        {
+            const auto& edge = buffer[count];
+            if(edge.v1 < 0 || edge.v1 >= vertices || edge.v2 < 0 || edge.v2 >= vertices)
+                throw std::out_of_range("Vertex does not exist");
+            ++count;
+        }
+        else
+            finished = true;
+    }
+    return count;
+}
+
+#define GRAPHS_INSTANTIATE_EDGE_STREAMS(W)                                                                             \
+    template class BasicIstreamEdgeStream<W>;                                                                          \
+    template class BasicMappedEdgeStream<W>;                                                                           \
+    template class BasicGeneratorEdgeStream<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_EDGE_STREAMS)
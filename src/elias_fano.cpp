@@ -0,0 +1,175 @@
+#include "graphs/elias_fano.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace
+{
+// Pozycja k-tej (od 0) jedynki w slowie; slowo ma wiecej niz k jedynek
+int selectInWord(std::uint64_t word, int k)
+{
+    for(int i = 0; i < k; ++i)
+    {
+        word &= word - 1;
+    }
+    return countTrailingZeros(word);
+}
+} // namespace
+
+// Złożoność czasowa: O(N / 64), pamięciowa: O(N / 64)
+BitVector::BitVector(std::vector<std::uint64_t> bits, std::size_t size) : words(std::move(bits)), bitCount(size)
+{
+    words.resize((bitCount + 63) / 64 + 1, 0); // zapasowe slowo dla przegladania za ostatnia jedynka
+
+    std::size_t blocks = (words.size() + BlockWords - 1) / BlockWords;
+    blockRanks.resize(blocks + 1);
+    std::uint64_t ones = 0;
+    for(std::size_t w = 0; w < words.size(); ++w)
+    {
+        if(w % BlockWords == 0)
+            blockRanks[w / BlockWords] = ones;
+        ones += popcount(words[w]);
+    }
+    blockRanks[blocks] = ones;
+
+    std::uint64_t onesSeen = 0, zerosSeen = 0;
+    for(std::size_t w = 0; w * 64 < bitCount; ++w)
+    {
+        int valid = static_cast<int>(std::min<std::size_t>(64, bitCount - w * 64));
+        std::uint64_t mask = valid == 64 ? ~0ULL : (1ULL << valid) - 1;
+        std::uint64_t oneBits = words[w] & mask, zeroBits = ~words[w] & mask;
+        std::uint64_t oneCount = popcount(oneBits), zeroCount = popcount(zeroBits);
+
+        // Numer pierwszej probki, ktora wypada w tym slowie
+        std::uint64_t nextOne = (onesSeen + SampleRate - 1) / SampleRate * SampleRate;
+        for(; nextOne < onesSeen + oneCount; nextOne += SampleRate)
+        {
+            oneSamples.push_back(w * 64 + selectInWord(oneBits, static_cast<int>(nextOne - onesSeen)));
+        }
+        std::uint64_t nextZero = (zerosSeen + SampleRate - 1) / SampleRate * SampleRate;
+        for(; nextZero < zerosSeen + zeroCount; nextZero += SampleRate)
+        {
+            zeroSamples.push_back(w * 64 + selectInWord(zeroBits, static_cast<int>(nextZero - zerosSeen)));
+        }
+        onesSeen += oneCount;
+        zerosSeen += zeroCount;
+    }
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+std::size_t BitVector::rank1(std::size_t i) const
+{
+    std::size_t w = i / 64;
+    std::size_t rank = blockRanks[w / BlockWords];
+    for(std::size_t j = w / BlockWords * BlockWords; j < w; ++j)
+    {
+        rank += popcount(words[j]);
+    }
+    if(i % 64 != 0)
+        rank += popcount(words[w] << (64 - i % 64));
+    return rank;
+}
+
+// Od probki przeglada slowa do tego, ktore zawiera szukana jedynke.
+// Złożoność czasowa: O(1) dla rozkladu bez dlugich przerw, pamięciowa: O(1)
+std::size_t BitVector::select1(std::size_t k) const
+{
+    std::size_t w = oneSamples[k / SampleRate] / 64;
+    std::size_t remaining = k - rank1(w * 64);
+    for(std::size_t ones = popcount(words[w]); ones <= remaining; ones = popcount(words[w]))
+    {
+        remaining -= ones;
+        ++w;
+    }
+    return w * 64 + selectInWord(words[w], static_cast<int>(remaining));
+}
+
+// Złożoność czasowa: O(1) dla rozkladu bez dlugich przerw, pamięciowa: O(1)
+std::size_t BitVector::select0(std::size_t k) const
+{
+    std::size_t w = zeroSamples[k / SampleRate] / 64;
+    std::size_t remaining = k - rank0(w * 64);
+    for(std::size_t zeros = popcount(~words[w]); zeros <= remaining; zeros = popcount(~words[w]))
+    {
+        remaining -= zeros;
+        ++w;
+    }
+    return w * 64 + selectInWord(~words[w], static_cast<int>(remaining));
+}
+
+std::size_t BitVector::memoryUsage() const
+{
+    return (words.size() + blockRanks.size() + oneSamples.size() + zeroSamples.size()) * sizeof(std::uint64_t);
+}
+
+// Złożoność czasowa: O(n + universe / 2^l), pamięciowa: O(n (2 + l) / 64)
+EliasFano::EliasFano(const std::vector<std::uint64_t>& values, std::uint64_t universe)
+    : count(values.size()), universe(universe)
+{
+    if(count == 0)
+        return;
+    if(universe / count > 1)
+        lowBits = highestBit(universe / count);
+
+    lows.assign((count * lowBits + 63) / 64 + 1, 0);
+    std::size_t highBits = count + (universe >> lowBits) + 1;
+    std::vector<std::uint64_t> upper((highBits + 63) / 64, 0);
+
+    std::uint64_t previous = 0;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        std::uint64_t value = values[i];
+        if(value < previous || value >= universe)
+        {
+            throw std::invalid_argument("Elias-Fano values must be non-decreasing and below the universe");
+        }
+        previous = value;
+
+        if(lowBits != 0)
+        {
+            std::uint64_t lowPart = value & (~0ULL >> (64 - lowBits));
+            std::size_t bit = i * lowBits;
+            lows[bit / 64] |= lowPart << (bit % 64);
+            if(bit % 64 + lowBits > 64)
+                lows[bit / 64 + 1] |= lowPart >> (64 - bit % 64);
+        }
+        std::size_t position = (value >> lowBits) + i;
+        upper[position / 64] |= 1ULL << (position % 64);
+    }
+    highs = BitVector(std::move(upper), highBits);
+}
+
+// Koszyk starszych bitow x zaczyna sie za (x >> l)-tym zerem; jego wartosci sa porownywane po mlodszych bitach.
+// Złożoność czasowa: O(1 + rozmiar koszyka), pamięciowa: O(1)
+std::size_t EliasFano::lowerBound(std::uint64_t x) const
+{
+    if(count == 0 || x >= universe)
+        return count;
+
+    std::uint64_t bucket = x >> lowBits;
+    std::size_t position = bucket == 0 ? 0 : highs.select0(bucket - 1) + 1;
+    std::size_t i = position - bucket;
+    std::uint64_t lowPart = lowBits == 0 ? 0 : x & (~0ULL >> (64 - lowBits));
+    for(; highs[position]; ++position, ++i)
+    {
+        if(low(i) >= lowPart)
+            break;
+    }
+    return i;
+}
+
+std::size_t EliasFano::memoryUsage() const
+{
+    return lows.size() * sizeof(std::uint64_t) + highs.memoryUsage();
+}
+
+// Złożoność czasowa: O(1) oczekiwana, pamięciowa: O(1)
+EliasFano::Cursor::Cursor(const EliasFano& sequence, std::size_t index)
+    : sequence(&sequence), index(index), wordIndex(0), buffer(0)
+{
+    if(index < sequence.count)
+    {
+        std::size_t position = sequence.highs.select1(index);
+        wordIndex = position / 64;
+        buffer = sequence.highs.word(wordIndex) & (~0ULL << (position % 64));
+    }
+}
@@ -0,0 +1,68 @@
+#include "graphs/graph_cache.hpp"
+
+template <typename W>
+BasicGraphCache<W>& BasicGraphCache<W>::instance()
+{
+    static BasicGraphCache cache;
+    return cache;
+}
+
+// Parsowanie odbywa sie poza blokada, wiec rozne pliki moga byc wczytywane rownolegle; ten sam plik
+// wczytywany jednoczesnie przez dwa watki jest parsowany dwa razy, a w pamieci zostaje ostatni wynik.
+// Złożoność czasowa: O(1) przy trafieniu, O(rozmiar pliku) przy chybieniu, pamięciowa: O(V + E)
+template <typename W>
+std::shared_ptr<const BasicEdgeList<W>> BasicGraphCache<W>::edgeList(const std::filesystem::path& path)
+{
+    std::filesystem::path absolutePath = std::filesystem::absolute(path).lexically_normal();
+    std::uintmax_t fileSize = std::filesystem::file_size(absolutePath);
+    std::filesystem::file_time_type modified = std::filesystem::last_write_time(absolutePath);
+    std::string key = absolutePath.string();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if(it != entries.end() && it->second.fileSize == fileSize && it->second.modified == modified)
+        {
+            ++hitCount;
+            return it->second.edgeList;
+        }
+    }
+
+    auto parsed = std::make_shared<const BasicEdgeList<W>>(loadEdgeList<W>(absolutePath));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ++missCount;
+    entries[key] = {fileSize, modified, parsed};
+    return parsed;
+}
+
+template <typename W>
+void BasicGraphCache<W>::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+template <typename W>
+std::size_t BasicGraphCache<W>::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+template <typename W>
+std::size_t BasicGraphCache<W>::hits() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return hitCount;
+}
+
+template <typename W>
+std::size_t BasicGraphCache<W>::misses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return missCount;
+}
+
+#define GRAPHS_INSTANTIATE_GRAPH_CACHE(W) template class BasicGraphCache<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_GRAPH_CACHE)
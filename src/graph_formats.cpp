@@ -0,0 +1,232 @@
+#include "graphs/graph_formats.hpp"
+#include <algorithm>
+#include <cctype>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "graphs/mapped_file.hpp"
+#include "graphs/text_cursor.hpp"
+
+namespace
+{
+// Wierzcholek numerowany od 1 (DIMACS, Matrix Market) zamieniony na indeks 0..count-1
+int readOneBased(TextCursor& cursor, int count, const char* what)
+{
+    int v = cursor.read<int>(what);
+    if(v < 1 || v > count)
+        throw ParseError(cursor.line(), std::string(what) + " " + std::to_string(v) + " does not exist");
+    return v - 1;
+}
+
+bool equalsIgnoreCase(std::string_view word, std::string_view expected)
+{
+    return std::equal(word.begin(), word.end(), expected.begin(), expected.end(), [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+    });
+}
+
+// Rezerwacja na podstawie deklarowanej liczby krawedzi, ograniczona rozmiarem pliku
+// (linia krawedzi ma co najmniej 4 znaki)
+std::size_t edgeReserve(long long declared, const char* begin, const char* end)
+{
+    return static_cast<std::size_t>(std::min<long long>(declared, (end - begin) / 4 + 1));
+}
+} // namespace
+
+// Złożoność czasowa: O(rozmiar wejscia), pamięciowa: O(E)
+template <typename W>
+BasicEdgeList<W> parseDimacs(const char* begin, const char* end)
+{
+    TextCursor cursor(begin, end);
+    BasicEdgeList<W> result;
+    int edgeCount = -1;
+
+    while(!cursor.atEnd())
+    {
+        if(cursor.peek() == 'c')
+        {
+            cursor.skipLine();
+            continue;
+        }
+
+        std::string_view tag = cursor.readWord("line type");
+        if(tag == "p")
+        {
+            if(edgeCount >= 0)
+                throw ParseError(cursor.line(), "duplicate problem line");
+            cursor.readWord("problem type");
+            result.vertexCount = cursor.read<int>("vertex count");
+            edgeCount = cursor.read<int>("arc count");
+            if(result.vertexCount < 0 || edgeCount < 0)
+                throw ParseError(cursor.line(), "negative problem size");
+            result.edges.reserve(edgeReserve(edgeCount, begin, end));
+        }
+        else if(tag == "a")
+        {
+            if(edgeCount < 0)
+                throw ParseError(cursor.line(), "arc before problem line");
+            typename BasicGraph<W>::EdgeInput edge;
+            edge.v1 = readOneBased(cursor, result.vertexCount, "start vertex");
+            edge.v2 = readOneBased(cursor, result.vertexCount, "end vertex");
+            edge.weight = cursor.read<W>("edge weight");
+            result.edges.push_back(edge);
+        }
+        else
+        {
+            throw ParseError(cursor.line(), "unknown line type \"" + std::string(tag) + "\"");
+        }
+    }
+
+    if(edgeCount < 0)
+        throw ParseError(cursor.line(), "missing problem line");
+    if(result.edges.size() != static_cast<std::size_t>(edgeCount))
+        throw ParseError(cursor.line(), "expected " + std::to_string(edgeCount) + " arcs, found " +
+                                            std::to_string(result.edges.size()));
+    return result;
+}
+
+template <typename W>
+BasicEdgeList<W> loadDimacs(const std::filesystem::path& path)
+{
+    MappedFile file(path);
+    return parseDimacs<W>(file.begin(), file.end());
+}
+
+// Złożoność czasowa: O(rozmiar wejscia), pamięciowa: O(E)
+template <typename W>
+BasicEdgeList<W> parseMatrixMarket(const char* begin, const char* end)
+{
+    TextCursor cursor(begin, end);
+    BasicEdgeList<W> result;
+
+    if(!equalsIgnoreCase(cursor.readWord("banner"), "%%MatrixMarket") ||
+       !equalsIgnoreCase(cursor.readWord("object"), "matrix"))
+        throw ParseError(cursor.line(), "expected \"%%MatrixMarket matrix\" banner");
+    if(!equalsIgnoreCase(cursor.readWord("format"), "coordinate"))
+        throw ParseError(cursor.line(), "only coordinate matrices are supported");
+
+    std::string_view field = cursor.readWord("field");
+    bool pattern = equalsIgnoreCase(field, "pattern");
+    if(!pattern && !equalsIgnoreCase(field, "real") && !equalsIgnoreCase(field, "integer"))
+        throw ParseError(cursor.line(), "unsupported field \"" + std::string(field) + "\"");
+
+    std::string_view symmetry = cursor.readWord("symmetry");
+    bool skew = equalsIgnoreCase(symmetry, "skew-symmetric");
+    bool mirrored = skew || equalsIgnoreCase(symmetry, "symmetric");
+    if(!mirrored && !equalsIgnoreCase(symmetry, "general"))
+        throw ParseError(cursor.line(), "unsupported symmetry \"" + std::string(symmetry) + "\"");
+    if(skew && (pattern || std::is_unsigned_v<W>))
+        throw ParseError(cursor.line(), "skew-symmetric matrix needs signed weights");
+
+    while(!cursor.atEnd() && cursor.peek() == '%')
+        cursor.skipLine();
+
+    int rows = cursor.read<int>("row count");
+    int columns = cursor.read<int>("column count");
+    long long entries = cursor.read<long long>("entry count");
+    if(rows < 0 || columns < 0 || entries < 0)
+        throw ParseError(cursor.line(), "negative matrix size");
+    if(mirrored && rows != columns)
+        throw ParseError(cursor.line(), "symmetric matrix must be square");
+
+    result.vertexCount = std::max(rows, columns);
+    result.edges.reserve(edgeReserve(mirrored ? 2 * entries : entries, begin, end));
+    for(long long k = 0; k < entries; ++k)
+    {
+        typename BasicGraph<W>::EdgeInput edge;
+        edge.v1 = readOneBased(cursor, rows, "row");
+        edge.v2 = readOneBased(cursor, columns, "column");
+        edge.weight = pattern ? W{1} : cursor.read<W>("edge weight");
+        if(!cursor.atLineEnd())
+            throw ParseError(cursor.line(), "too many values in line");
+        // Macierz symetryczna zapisuje tylko dolny trojkat, skosnie symetryczna - bez przekatnej
+        if(mirrored && (edge.v1 < edge.v2 || (skew && edge.v1 == edge.v2)))
+            throw ParseError(cursor.line(), "entry outside the stored triangle of a symmetric matrix");
+        result.edges.push_back(edge);
+
+        if(mirrored && edge.v1 != edge.v2)
+            result.edges.push_back({edge.v2, edge.v1, skew ? static_cast<W>(-edge.weight) : edge.weight});
+    }
+
+    if(!cursor.atEnd())
+        throw ParseError(cursor.line(), "unexpected data after matrix entries");
+    return result;
+}
+
+template <typename W>
+BasicEdgeList<W> loadMatrixMarket(const std::filesystem::path& path)
+{
+    MappedFile file(path);
+    return parseMatrixMarket<W>(file.begin(), file.end());
+}
+
+// Identyfikatory sa zbierane w trakcie parsowania, sortowane i zamieniane na pozycje w posortowanej liscie.
+// Złożoność czasowa: O(rozmiar wejscia + E log E), pamięciowa: O(E)
+template <typename W>
+BasicEdgeList<W> parseSnapEdgeList(const char* begin, const char* end, std::vector<int>* vertexIds)
+{
+    TextCursor cursor(begin, end);
+    BasicEdgeList<W> result;
+    result.edges.reserve(static_cast<std::size_t>(end - begin) / 8);
+
+    while(!cursor.atEnd())
+    {
+        if(cursor.peek() == '#')
+        {
+            cursor.skipLine();
+            continue;
+        }
+
+        typename BasicGraph<W>::EdgeInput edge;
+        edge.v1 = cursor.read<int>("start vertex");
+        if(cursor.atLineEnd())
+            throw ParseError(cursor.line(), "expected \"u v\" or \"u v weight\"");
+        edge.v2 = cursor.read<int>("end vertex");
+        if(edge.v1 < 0 || edge.v2 < 0)
+            throw ParseError(cursor.line(), "negative vertex id");
+        edge.weight = cursor.atLineEnd() ? W{1} : cursor.read<W>("edge weight");
+        if(!cursor.atLineEnd())
+            throw ParseError(cursor.line(), "too many values in line");
+
+        result.edges.push_back(edge);
+    }
+
+    std::vector<int> ids;
+    ids.reserve(2 * result.edges.size());
+    for(const auto& edge : result.edges)
+    {
+        ids.push_back(edge.v1);
+        ids.push_back(edge.v2);
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    auto indexOf = [&ids](int id) {
+        return static_cast<int>(std::lower_bound(ids.begin(), ids.end(), id) - ids.begin());
+    };
+    for(auto& edge : result.edges)
+    {
+        edge.v1 = indexOf(edge.v1);
+        edge.v2 = indexOf(edge.v2);
+    }
+    result.vertexCount = static_cast<int>(ids.size());
+    if(vertexIds)
+        *vertexIds = std::move(ids);
+    return result;
+}
+
+template <typename W>
+BasicEdgeList<W> loadSnapEdgeList(const std::filesystem::path& path, std::vector<int>* vertexIds)
+{
+    MappedFile file(path);
+    return parseSnapEdgeList<W>(file.begin(), file.end(), vertexIds);
+}
+
+#define GRAPHS_INSTANTIATE_GRAPH_FORMATS(W)                                                                            \
+    template BasicEdgeList<W> parseDimacs(const char*, const char*);                                                  \
+    template BasicEdgeList<W> loadDimacs(const std::filesystem::path&);                                               \
+    template BasicEdgeList<W> parseMatrixMarket(const char*, const char*);                                            \
+    template BasicEdgeList<W> loadMatrixMarket(const std::filesystem::path&);                                         \
+    template BasicEdgeList<W> parseSnapEdgeList(const char*, const char*, std::vector<int>*);                         \
+    template BasicEdgeList<W> loadSnapEdgeList(const std::filesystem::path&, std::vector<int>*);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_GRAPH_FORMATS)
@@ -1,6 +1,14 @@
 ﻿#include "graphs/adjacency_list_graph.hpp"
 #include "graphs/adjacency_matrix_graph.hpp"
+#include "graphs/compressed_graph.hpp"
+#include "graphs/csr_graph.hpp"
+#include "graphs/graph_cache.hpp"
+#include "graphs/indexed_heap.hpp"
+#include "graphs/prefetch_loader.hpp"
+#include "graphs/shortest_path_algorithms.hpp"
+#include <chrono>
 #include <fstream>
+#include <limits>
 #include <iostream>
 #include <memory>
 #include <random>
@@ -58,6 +66,169 @@ void generateRandomGraph(const std::string& filename, int vertexCount, int edgeC
     }
 }
 
+// Bellman-Ford na wszystkich grafach z katalogu (np. sp_data/graph) w reprezentacji G.
+// Kolejne pliki sa wczytywane w tle podczas pomiaru biezacego, wiec czas calosci jest bliski czasowi algorytmu.
+template <typename G>
+void runShortestPathSweep(const std::filesystem::path& directory)
+{
+    using Clock = std::chrono::steady_clock;
+    std::chrono::duration<double, std::milli> algorithmTime{0};
+    auto sweepStart = Clock::now();
+
+    PrefetchLoader loader{directory, ".txt"};
+    PrefetchLoader::Item item;
+    for(;;)
+    {
+        try
+        {
+            if(!loader.next(item))
+                break;
+        }
+        catch(const std::exception& e)
+        {
+            std::cerr << "Skipping file: " << e.what() << "\n";
+            continue;
+        }
+
+        auto graph = G::createGraph(item.edgeList);
+        ShortestPathTree tree;
+        auto start = Clock::now();
+        bool valid = bellmanFord(*graph, item.edgeList.source.value_or(0), tree);
+        std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+        algorithmTime += elapsed;
+
+        std::cout << item.path.filename().string() << ": " << elapsed.count() << " ms"
+                  << (valid ? "" : " (negative cycle)") << "\n";
+    }
+
+    std::chrono::duration<double, std::milli> sweepTime = Clock::now() - sweepStart;
+    std::cout << "Algorithm time: " << algorithmTime.count() << " ms, total time: " << sweepTime.count() << " ms\n";
+}
+
+// BFS od wierzcholka 0: visitNeighbors(u, f) wola f(v) dla kazdego nastepnika, prefetch(u) zapowiada liste u.
+// Zwraca liczbe odwiedzonych wierzcholkow.
+template <typename VisitNeighbors, typename Prefetch>
+int breadthFirstSearch(int vertexCount, VisitNeighbors visitNeighbors, Prefetch prefetch)
+{
+    std::vector<int> queue(vertexCount);
+    std::vector<char> visited(vertexCount, 0);
+    int head = 0, tail = 0;
+    queue[tail++] = 0;
+    visited[0] = 1;
+    while(head < tail)
+    {
+        // Lista wierzcholka kilka pozycji dalej w kolejce laduje sie w tle
+        if(head + 4 < tail)
+            prefetch(queue[head + 4]);
+        int u = queue[head++];
+        visitNeighbors(u, [&](int v, int) {
+            if(!visited[v])
+            {
+                visited[v] = 1;
+                queue[tail++] = v;
+            }
+        });
+    }
+    return tail;
+}
+
+// Dijkstra od wierzcholka 0 na kopcu indeksowanym: visitNeighbors(u, f) wola f(v, waga).
+// Zwraca sume skonczonych odleglosci (zeby pomiar nie zostal wyciety przez kompilator).
+template <typename VisitNeighbors, typename Prefetch>
+long long dijkstraFromZero(int vertexCount, VisitNeighbors visitNeighbors, Prefetch prefetch)
+{
+    std::vector<int> distance(vertexCount, std::numeric_limits<int>::max());
+    IndexedHeap<int> heap(vertexCount);
+    distance[0] = 0;
+    heap.push(0, 0);
+    long long total = 0;
+    while(!heap.empty())
+    {
+        int u = heap.pop();
+        total += distance[u];
+        // Nastepny wierzcholek do zdjecia jest juz znany - jego lista laduje sie podczas relaksacji biezacej
+        if(!heap.empty())
+            prefetch(heap.topItem());
+        visitNeighbors(u, [&](int v, int w) {
+            int candidate = distance[u] + w;
+            if(candidate >= distance[v] || heap.wasRemoved(v))
+                return;
+            distance[v] = candidate;
+            if(heap.contains(v))
+                heap.decreaseKey(v, candidate);
+            else
+                heap.push(v, candidate);
+        });
+    }
+    return total;
+}
+
+// Porownanie przejsc po CSR i po grafie skompresowanym na losowym grafie skierowanym (wagi 1..100).
+// Wypisuje najlepszy z kilku czasow BFS i Dijkstry dla obu reprezentacji oraz zajmowana pamiec.
+void compareCompressedTraversal(int vertexCount, int edgeCount)
+{
+    if(vertexCount <= 0 || edgeCount < 0)
+    {
+        throw std::invalid_argument("Nieprawidlowy rozmiar grafu");
+    }
+
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<> vertexDist(0, vertexCount - 1);
+    std::uniform_int_distribution<> weightDist(1, 100);
+    EdgeList edgeList;
+    edgeList.vertexCount = vertexCount;
+    edgeList.edges.reserve(edgeCount);
+    for(int e = 0; e < edgeCount; ++e)
+    {
+        edgeList.edges.push_back({vertexDist(gen), vertexDist(gen), weightDist(gen)});
+    }
+
+    auto csrGraph = CsrGraph::createGraph(edgeList);
+    auto compressedGraph = CompressedGraph::createGraph(edgeList);
+    const auto& csr = static_cast<const CsrGraph&>(*csrGraph);
+    const auto& compressed = static_cast<const CompressedGraph&>(*compressedGraph);
+
+    auto csrNeighbors = [&csr](int u, auto visit) {
+        for(int slot = csr.outBegin(u); slot < csr.outEnd(u); ++slot)
+            visit(csr.target(slot), csr.weight(slot));
+    };
+    auto csrPrefetch = [&csr](int u) { csr.prefetch(u); };
+    auto compressedNeighbors = [&compressed](int u, auto visit) {
+        for(auto cursor = compressed.neighbors(u); cursor.next();)
+            visit(cursor.target(), compressed.weight(cursor.edge()));
+    };
+    auto compressedPrefetch = [&compressed](int u) { compressed.prefetch(u); };
+
+    using Clock = std::chrono::steady_clock;
+    long long checksum = 0;
+    auto bestOf = [&checksum](auto run) {
+        std::chrono::duration<double, std::milli> best{std::numeric_limits<double>::max()};
+        for(int repeat = 0; repeat < 5; ++repeat)
+        {
+            auto start = Clock::now();
+            checksum += run();
+            best = std::min<std::chrono::duration<double, std::milli>>(best, Clock::now() - start);
+        }
+        return best.count();
+    };
+
+    double csrBfs = bestOf([&] { return breadthFirstSearch(vertexCount, csrNeighbors, csrPrefetch); });
+    double compressedBfs =
+        bestOf([&] { return breadthFirstSearch(vertexCount, compressedNeighbors, compressedPrefetch); });
+    double csrDijkstra = bestOf([&] { return dijkstraFromZero(vertexCount, csrNeighbors, csrPrefetch); });
+    double compressedDijkstra =
+        bestOf([&] { return dijkstraFromZero(vertexCount, compressedNeighbors, compressedPrefetch); });
+
+    std::cout << "BFS: CSR " << csrBfs << " ms, compressed " << compressedBfs << " ms ("
+              << compressedBfs / csrBfs << "x)\n";
+    std::cout << "Dijkstra: CSR " << csrDijkstra << " ms, compressed " << compressedDijkstra << " ms ("
+              << compressedDijkstra / csrDijkstra << "x)\n";
+    std::cout << "Memory: CSR " << csr.memoryUsage() / (1024.0 * 1024.0) << " MB, compressed "
+              << compressed.memoryUsage() / (1024.0 * 1024.0) << " MB ("
+              << static_cast<double>(csr.memoryUsage()) / compressed.memoryUsage() << "x smaller)\n";
+    std::cout << "Checksum: " << checksum << "\n";
+}
+
 void displayMenu()
 {
     std::cout << "\n=== GRAPH MENU ===\n";
@@ -73,6 +244,8 @@ void displayMenu()
     std::cout << "10. Display incident edges\n";
     std::cout << "11. Display graph\n";
     std::cout << "12. Generate random graph\n";
+    std::cout << "13. Run shortest path sweep over directory\n";
+    std::cout << "14. Compare compressed graph and CSR traversal\n";
     std::cout << "0. Exit\n";
     std::cout << "Enter choice: ";
 }
@@ -97,8 +270,7 @@ void handleUserInputList(std::unique_ptr<Graph>& graph)
                     std::cout << "Enter file name: ";
                     std::cin >> name;
                     std::string filePath = filename + name + txt;
-                    std::ifstream file(filePath);
-                    graph = AdjacencyListGraph::createGraph(file);
+                    graph = loadCachedGraph<AdjacencyListGraph>(filePath);
                     std::cout << "Graph loaded successfully!\n";
                     break;
                 }
@@ -219,6 +391,24 @@ void handleUserInputList(std::unique_ptr<Graph>& graph)
                     break;
                 }
 
+                case 13:
+                {
+                    std::string directory;
+                    std::cout << "Enter directory: ";
+                    std::cin >> directory;
+                    runShortestPathSweep<AdjacencyListGraph>(directory);
+                    break;
+                }
+
+                case 14:
+                {
+                    int v, e;
+                    std::cout << "Enter number of vertices and edges (V E): ";
+                    std::cin >> v >> e;
+                    compareCompressedTraversal(v, e);
+                    break;
+                }
+
                 case 0:
                     std::cout << "Exiting program\n";
                     break;
@@ -255,8 +445,7 @@ void handleUserInputMatrix(std::unique_ptr<Graph>& graph)
                     std::cout << "Enter file name: ";
                     std::cin >> name;
                     std::string filePath = filename + name + txt;
-                    std::ifstream file(filePath);
-                    graph = AdjacencyMatrixGraph::createGraph(file);
+                    graph = loadCachedGraph<AdjacencyMatrixGraph>(filePath);
                     std::cout << "Graph loaded successfully!\n";
                     break;
                 }
@@ -375,6 +564,24 @@ void handleUserInputMatrix(std::unique_ptr<Graph>& graph)
                     break;
                 }
 
+                case 13:
+                {
+                    std::string directory;
+                    std::cout << "Enter directory: ";
+                    std::cin >> directory;
+                    runShortestPathSweep<AdjacencyMatrixGraph>(directory);
+                    break;
+                }
+
+                case 14:
+                {
+                    int v, e;
+                    std::cout << "Enter number of vertices and edges (V E): ";
+                    std::cin >> v >> e;
+                    compareCompressedTraversal(v, e);
+                    break;
+                }
+
                 case 0:
                     std::cout << "Exiting program\n";
                     break;
@@ -0,0 +1,145 @@
+#include "graphs/mapped_file.hpp"
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+[[noreturn]] void throwOpenError(const std::filesystem::path& path)
+{
+    throw std::runtime_error("Cannot map file: " + path.string());
+}
+} // namespace
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::filesystem::path& path, AccessPattern access)
+{
+    DWORD flags = access == AccessPattern::Sequential ? FILE_FLAG_SEQUENTIAL_SCAN
+                  : access == AccessPattern::Random   ? FILE_FLAG_RANDOM_ACCESS
+                                                      : FILE_ATTRIBUTE_NORMAL;
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+    if(file == INVALID_HANDLE_VALUE)
+        throwOpenError(path);
+    fileHandle = file;
+
+    LARGE_INTEGER fileSize;
+    if(!GetFileSizeEx(file, &fileSize))
+    {
+        close();
+        throwOpenError(path);
+    }
+    if(fileSize.QuadPart == 0)
+        return;
+
+    mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if(mappingHandle == nullptr)
+    {
+        close();
+        throwOpenError(path);
+    }
+
+    mappedData = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if(mappedData == nullptr)
+    {
+        close();
+        throwOpenError(path);
+    }
+    mappedSize = static_cast<std::size_t>(fileSize.QuadPart);
+}
+
+void MappedFile::close()
+{
+    if(mappedData != nullptr)
+        UnmapViewOfFile(mappedData);
+    if(mappingHandle != nullptr)
+        CloseHandle(mappingHandle);
+    if(fileHandle != nullptr)
+        CloseHandle(fileHandle);
+
+    mappedData = nullptr;
+    mappedSize = 0;
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+}
+
+#else
+
+// Deskryptor jest zamykany od razu po mmap - odwzorowanie pozostaje wazne.
+MappedFile::MappedFile(const std::filesystem::path& path, AccessPattern access)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        throwOpenError(path);
+
+    struct stat status;
+    if(::fstat(fd, &status) != 0)
+    {
+        ::close(fd);
+        throwOpenError(path);
+    }
+    if(status.st_size == 0)
+    {
+        ::close(fd);
+        return;
+    }
+
+    void* address = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(address == MAP_FAILED)
+        throwOpenError(path);
+
+    if(access != AccessPattern::Normal)
+    {
+        ::madvise(address, static_cast<std::size_t>(status.st_size),
+                  access == AccessPattern::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+    }
+
+    mappedData = static_cast<const char*>(address);
+    mappedSize = static_cast<std::size_t>(status.st_size);
+}
+
+void MappedFile::close()
+{
+    if(mappedData != nullptr)
+        ::munmap(const_cast<char*>(mappedData), mappedSize);
+
+    mappedData = nullptr;
+    mappedSize = 0;
+}
+
+#endif
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if(this != &other)
+    {
+        close();
+        std::swap(mappedData, other.mappedData);
+        std::swap(mappedSize, other.mappedSize);
+#if defined(_WIN32)
+        std::swap(fileHandle, other.fileHandle);
+        std::swap(mappingHandle, other.mappingHandle);
+#endif
+    }
+    return *this;
+}
@@ -1,11 +1,224 @@
 #include "graphs/minimum_spanning_tree_algorithms.hpp"
+#include "graphs/csr_graph.hpp"
 
-void kruskal(Graph& graph, MinimumSpanningTreeResult& result)
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+namespace
+{
+// Struktura zbiorow rozlacznych z kompresja sciezek i laczeniem wedlug rangi.
+class DisjointSets
+{
+    std::vector<int> parent;
+    std::vector<int> rank;
+
+  public:
+    explicit DisjointSets(int n) : parent(n), rank(n, 0) { std::iota(parent.begin(), parent.end(), 0); }
+
+    int find(int x)
+    {
+        while(parent[x] != x)
+        {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    bool unite(int a, int b)
+    {
+        a = find(a);
+        b = find(b);
+        if(a == b)
+            return false;
+        if(rank[a] < rank[b])
+            std::swap(a, b);
+        parent[b] = a;
+        if(rank[a] == rank[b])
+            ++rank[a];
+        return true;
+    }
+};
+
+// Sprawdza konce krawedzi porcji przed indeksowaniem DisjointSets (strumien moze byc dowolna implementacja).
+// Złożoność czasowa: O(count), pamięciowa: O(1)
+template <typename EdgeInput>
+void checkBatch(const std::vector<EdgeInput>& batch, std::size_t count, int vertexCount)
 {
-    // TODO: implement
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        const EdgeInput& edge = batch[i];
+        if(edge.v1 < 0 || edge.v1 >= vertexCount || edge.v2 < 0 || edge.v2 >= vertexCount)
+            throw std::out_of_range("Vertex does not exist");
+    }
 }
+} // namespace
 
-void prim(Graph& graph, MinimumSpanningTreeResult& result)
+// Algorytm Kruskala na reprezentacji CSR.
+// Sortuje sloty krawedzi po wadze (stabilnie, wiec przy rownych wagach decyduje kolejnosc w CSR)
+// i dodaje kolejne krawedzie, ktore nie tworza cyklu.
+// Złożoność czasowa: O(E log E), pamięciowa: O(V + E)
+template <typename W>
+void kruskal(BasicGraph<W>& graph, BasicMinimumSpanningTreeResult<W>& result)
 {
-    // TODO: implement
+    std::unique_ptr<BasicCsrGraph<W>> storage;
+    const BasicCsrGraph<W>& csr = asCsr(graph, storage);
+
+    std::vector<int> slots(csr.numEdges());
+    std::iota(slots.begin(), slots.end(), 0);
+    std::stable_sort(slots.begin(), slots.end(), [&csr](int a, int b) { return csr.weight(a) < csr.weight(b); });
+
+    result.clear();
+    DisjointSets sets(csr.numVertices());
+    for(int slot : slots)
+    {
+        int u = csr.source(slot);
+        int v = csr.target(slot);
+        if(sets.unite(u, v))
+        {
+            result.push_back({csr.vertexAt(u), csr.vertexAt(v), csr.weight(slot)});
+            if(static_cast<int>(result.size()) == csr.numVertices() - 1)
+                break;
+        }
+    }
 }
+
+// Algorytm Prima na reprezentacji CSR z kolejka priorytetowa (leniwe usuwanie).
+// Krawedzie traktowane sa jako nieskierowane: z wierzcholka przegladane sa krawedzie
+// wychodzace i wchodzace. Dla grafu niespojnego buduje las rozpinajacy.
+// Złożoność czasowa: O(E log E), pamięciowa: O(V + E)
+template <typename W>
+void prim(BasicGraph<W>& graph, BasicMinimumSpanningTreeResult<W>& result)
+{
+    std::unique_ptr<BasicCsrGraph<W>> storage;
+    const BasicCsrGraph<W>& csr = asCsr(graph, storage);
+
+    using Candidate = std::pair<W, int>; // waga, slot CSR
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+    std::vector<bool> inTree(csr.numVertices(), false);
+
+    auto addVertex = [&](int u) {
+        inTree[u] = true;
+        for(int slot = csr.outBegin(u); slot < csr.outEnd(u); ++slot)
+        {
+            if(!inTree[csr.target(slot)])
+                queue.emplace(csr.weight(slot), slot);
+        }
+        for(int i = csr.inBegin(u); i < csr.inEnd(u); ++i)
+        {
+            int slot = csr.inSlot(i);
+            if(!inTree[csr.source(slot)])
+                queue.emplace(csr.weight(slot), slot);
+        }
+    };
+
+    result.clear();
+    for(int root = 0; root < csr.numVertices(); ++root)
+    {
+        if(inTree[root])
+            continue;
+
+        addVertex(root);
+        while(!queue.empty())
+        {
+            int slot = queue.top().second;
+            queue.pop();
+
+            int u = csr.source(slot);
+            int v = csr.target(slot);
+            if(inTree[u] && inTree[v])
+                continue;
+
+            result.push_back({csr.vertexAt(u), csr.vertexAt(v), csr.weight(slot)});
+            addVertex(inTree[u] ? v : u);
+        }
+    }
+}
+
+// Algorytm Kruskala na strumieniu krawedzi.
+// Trzyma tylko biezacy las (posortowany po wadze) i jedna porcje krawedzi: porcja jest sortowana
+// stabilnie, scalana z lasem (przy rownych wagach las pierwszy, bo jego krawedzie byly wczesniej
+// w strumieniu) i Kruskal na scalonej liscie daje nowy las. Krawedz odrzucona zamyka cykl, w ktorym
+// jest najciezsza, wiec nie nalezy tez do drzewa calego grafu.
+// Złożoność czasowa: O(E log B + (E / B) * V), pamięciowa: O(V + B), B = batchSize
+template <typename W>
+void kruskal(BasicEdgeStream<W>& stream, BasicMinimumSpanningTreeResult<W>& result, std::size_t batchSize)
+{
+    using EdgeInput = typename BasicEdgeStream<W>::EdgeInput;
+    auto lighter = [](const EdgeInput& a, const EdgeInput& b) { return a.weight < b.weight; };
+
+    int vertexCount = stream.vertexCount();
+    std::vector<EdgeInput> forest;
+    std::vector<EdgeInput> batch(std::max<std::size_t>(batchSize, 1));
+    std::vector<EdgeInput> merged;
+    forest.reserve(vertexCount);
+    merged.reserve(vertexCount + batch.size());
+
+    for(std::size_t count; (count = stream.read({batch.data(), batch.size()})) > 0;)
+    {
+        checkBatch(batch, count, vertexCount);
+        std::stable_sort(batch.begin(), batch.begin() + count, lighter);
+        merged.clear();
+        std::merge(forest.begin(), forest.end(), batch.begin(), batch.begin() + count, std::back_inserter(merged),
+                   lighter);
+
+        forest.clear();
+        DisjointSets sets(vertexCount);
+        for(const EdgeInput& edge : merged)
+        {
+            if(sets.unite(edge.v1, edge.v2))
+                forest.push_back(edge);
+        }
+    }
+
+    result.clear();
+    for(const EdgeInput& edge : forest)
+    {
+        result.push_back({edge.v1, edge.v2, edge.weight});
+    }
+}
+
+// Spojne skladowe przez laczenie zbiorow rozlacznych dla kolejnych porcji strumienia.
+// Złożoność czasowa: O(V + E * alfa(V)), pamięciowa: O(V + B), B = batchSize
+template <typename W>
+int connectedComponents(BasicEdgeStream<W>& stream, std::vector<int>& component, std::size_t batchSize)
+{
+    using EdgeInput = typename BasicEdgeStream<W>::EdgeInput;
+
+    int vertexCount = stream.vertexCount();
+    std::vector<EdgeInput> batch(std::max<std::size_t>(batchSize, 1));
+    DisjointSets sets(vertexCount);
+    for(std::size_t count; (count = stream.read({batch.data(), batch.size()})) > 0;)
+    {
+        checkBatch(batch, count, vertexCount);
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            sets.unite(batch[i].v1, batch[i].v2);
+        }
+    }
+
+    // Numer skladowej nadaje korzen przy pierwszym (najmniejszym) wierzcholku zbioru
+    std::vector<int> labels(vertexCount, -1);
+    component.assign(vertexCount, -1);
+    int components = 0;
+    for(int v = 0; v < vertexCount; ++v)
+    {
+        int& label = labels[sets.find(v)];
+        if(label < 0)
+            label = components++;
+        component[v] = label;
+    }
+    return components;
+}
+
+#define GRAPHS_INSTANTIATE_SPANNING_TREES(W)                                                                           \
+    template void kruskal(BasicGraph<W>&, BasicMinimumSpanningTreeResult<W>&);                                         \
+    template void prim(BasicGraph<W>&, BasicMinimumSpanningTreeResult<W>&);                                           \
+    template void kruskal(BasicEdgeStream<W>&, BasicMinimumSpanningTreeResult<W>&, std::size_t);                      \
+    template int connectedComponents(BasicEdgeStream<W>&, std::vector<int>&, std::size_t);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_SPANNING_TREES)
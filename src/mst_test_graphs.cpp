@@ -2,7 +2,10 @@
 
 #include "graphs/adjacency_list_graph.hpp"
 #include "graphs/adjacency_matrix_graph.hpp"
+#include "graphs/csr_graph.hpp"
+#include "graphs/graph_cache.hpp"
 #include "graphs/minimum_spanning_tree_algorithms.hpp"
+#include "graphs/result_io.hpp"
 #include <filesystem>
 #include <fstream>
 
@@ -18,26 +21,30 @@ using namespace std::string_literals;
 const std::filesystem::path dataDirectoryPath{DATA_DIR_PATH};
 
 
-void readMstResult(std::ifstream &is, MinimumSpanningTreeResult &result) {
-    result.clear();
+TEST_CASE("Adjacency Matrix Graph -- Kruskal") {
+    auto[inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.25.txt",
+                                                        dataDirectoryPath / "mstResults" / "graphV10D0.25.txt"),
+                                        std::make_tuple(dataDirectoryPath / "graph" / "graphV70D0.75.txt",
+                                                        dataDirectoryPath / "mstResults" / "graphV70D0.75.txt"),
+                                        std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.5.txt",
+                                                        dataDirectoryPath / "mstResults" / "graphV200D0.5.txt"));
 
-    while (is) {
-        std::string line;
-        std::getline(is, line);
-        std::istringstream iss{line};
+    std::ifstream refStream{refFile};
+    auto graph = loadCachedGraph<AdjacencyMatrixGraph>(inputFile);
+
+    MinimumSpanningTreeResult result, refResult;
 
-        if (!line.empty()) {
-            MinimumSpanningEdge edge;
+    readMstResult(refStream, refResult);
+    std::sort(refResult.begin(),refResult.end());
 
-            iss >> edge.v1 >> edge.v2 >> edge.weight;
+    kruskal(*graph,result);
+    std::sort(result.begin(),result.end());
 
-            result.push_back(edge);
-        }
-    }
+    REQUIRE(result==refResult);
 }
 
-
-TEST_CASE("Adjacency Matrix Graph -- Kruskal") {
+TEST_CASE("Adjacency List Graph -- Kruskal")
+{
     auto[inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.25.txt",
                                                         dataDirectoryPath / "mstResults" / "graphV10D0.25.txt"),
                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV70D0.75.txt",
@@ -45,8 +52,8 @@ TEST_CASE("Adjacency Matrix Graph -- Kruskal") {
                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.5.txt",
                                                         dataDirectoryPath / "mstResults" / "graphV200D0.5.txt"));
 
-    std::ifstream inputStream{inputFile}, refStream{refFile};
-    auto graph = AdjacencyMatrixGraph::createGraph(inputStream);
+    std::ifstream refStream{refFile};
+    auto graph = loadCachedGraph<AdjacencyListGraph>(inputFile);
 
     MinimumSpanningTreeResult result, refResult;
 
@@ -59,7 +66,8 @@ TEST_CASE("Adjacency Matrix Graph -- Kruskal") {
     REQUIRE(result==refResult);
 }
 
-TEST_CASE("Adjacency List Graph -- Kruskal")
+
+TEST_CASE("Adjacency Matrix Graph -- Prim")
 {
     auto[inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.25.txt",
                                                         dataDirectoryPath / "mstResults" / "graphV10D0.25.txt"),
@@ -68,22 +76,44 @@ TEST_CASE("Adjacency List Graph -- Kruskal")
                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.5.txt",
                                                         dataDirectoryPath / "mstResults" / "graphV200D0.5.txt"));
 
-    std::ifstream inputStream{inputFile}, refStream{refFile};
-    auto graph = AdjacencyListGraph::createGraph(inputStream);
+    std::ifstream refStream{refFile};
+    auto graph = loadCachedGraph<AdjacencyMatrixGraph>(inputFile);
 
     MinimumSpanningTreeResult result, refResult;
 
     readMstResult(refStream, refResult);
     std::sort(refResult.begin(),refResult.end());
 
-    kruskal(*graph,result);
+    prim(*graph,result);
     std::sort(result.begin(),result.end());
 
     REQUIRE(result==refResult);
 }
 
+TEST_CASE("Adjacency List Graph -- Prim")
+{
+    auto[inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.25.txt",
+                                                        dataDirectoryPath / "mstResults" / "graphV10D0.25.txt"),
+                                        std::make_tuple(dataDirectoryPath / "graph" / "graphV70D0.75.txt",
+                                                        dataDirectoryPath / "mstResults" / "graphV70D0.75.txt"),
+                                        std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.5.txt",
+                                                        dataDirectoryPath / "mstResults" / "graphV200D0.5.txt"));
+
+    std::ifstream refStream{refFile};
+    auto graph = loadCachedGraph<AdjacencyListGraph>(inputFile);
 
-TEST_CASE("Adjacency Matrix Graph -- Prim")
+    MinimumSpanningTreeResult result, refResult;
+
+    readMstResult(refStream, refResult);
+    std::sort(refResult.begin(),refResult.end());
+
+    prim(*graph,result);
+    std::sort(result.begin(),result.end());
+
+    REQUIRE(result==refResult);
+}
+
+TEST_CASE("CSR Graph -- Kruskal")
 {
     auto[inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.25.txt",
                                                         dataDirectoryPath / "mstResults" / "graphV10D0.25.txt"),
@@ -93,20 +123,49 @@ TEST_CASE("Adjacency Matrix Graph -- Prim")
                                                         dataDirectoryPath / "mstResults" / "graphV200D0.5.txt"));
 
     std::ifstream inputStream{inputFile}, refStream{refFile};
-    auto graph = AdjacencyMatrixGraph::createGraph(inputStream);
+    auto graph = CsrGraph::createGraph(inputStream);
 
     MinimumSpanningTreeResult result, refResult;
 
     readMstResult(refStream, refResult);
     std::sort(refResult.begin(),refResult.end());
 
-    prim(*graph,result);
+    kruskal(*graph,result);
     std::sort(result.begin(),result.end());
 
     REQUIRE(result==refResult);
 }
 
-TEST_CASE("Adjacency List Graph -- Prim")
+TEST_CASE("Undirected Graphs -- Kruskal and Prim")
+{
+    auto[inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.25.txt",
+                                                        dataDirectoryPath / "mstResults" / "graphV10D0.25.txt"),
+                                        std::make_tuple(dataDirectoryPath / "graph" / "graphV70D0.75.txt",
+                                                        dataDirectoryPath / "mstResults" / "graphV70D0.75.txt"),
+                                        std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.5.txt",
+                                                        dataDirectoryPath / "mstResults" / "graphV200D0.5.txt"));
+
+    std::ifstream refStream{refFile};
+    auto listGraph = loadCachedGraph<AdjacencyListGraph>(inputFile, EdgeDirection::Undirected);
+    auto matrixGraph = loadCachedGraph<AdjacencyMatrixGraph>(inputFile, EdgeDirection::Undirected);
+
+    MinimumSpanningTreeResult result, refResult;
+
+    readMstResult(refStream, refResult);
+    std::sort(refResult.begin(),refResult.end());
+
+    for (Graph* graph : {listGraph.get(), matrixGraph.get()}) {
+        kruskal(*graph,result);
+        std::sort(result.begin(),result.end());
+        REQUIRE(result==refResult);
+
+        prim(*graph,result);
+        std::sort(result.begin(),result.end());
+        REQUIRE(result==refResult);
+    }
+}
+
+TEST_CASE("Edge Stream -- Kruskal and connected components")
 {
     auto[inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.25.txt",
                                                         dataDirectoryPath / "mstResults" / "graphV10D0.25.txt"),
@@ -116,15 +175,42 @@ TEST_CASE("Adjacency List Graph -- Prim")
                                                         dataDirectoryPath / "mstResults" / "graphV200D0.5.txt"));
 
     std::ifstream inputStream{inputFile}, refStream{refFile};
-    auto graph = AdjacencyListGraph::createGraph(inputStream);
+    IstreamEdgeStream istreamEdges{inputStream};
+    MappedEdgeStream mappedEdges{inputFile};
 
     MinimumSpanningTreeResult result, refResult;
 
     readMstResult(refStream, refResult);
     std::sort(refResult.begin(),refResult.end());
 
-    prim(*graph,result);
+    kruskal(istreamEdges,result);
     std::sort(result.begin(),result.end());
+    REQUIRE(result==refResult);
 
+    kruskal(mappedEdges,result,64);
+    std::sort(result.begin(),result.end());
     REQUIRE(result==refResult);
+
+    MappedEdgeStream componentEdges{inputFile};
+    std::vector<int> component;
+    REQUIRE(connectedComponents(componentEdges,component,64)==1);
+
+    // Krawedzie (i, i + 2) lacza osobno wierzcholki parzyste i nieparzyste
+    int next = 0;
+    GeneratorEdgeStream generated{10, [&next](EdgeStream::EdgeInput &edge) {
+        if (next + 2 >= 10)
+            return false;
+        edge = {next, next + 2, 1};
+        ++next;
+        return true;
+    }};
+    REQUIRE(connectedComponents(generated,component,3)==2);
+    REQUIRE(component==std::vector<int>{0, 1, 0, 1, 0, 1, 0, 1, 0, 1});
+
+    // Krawedz do wierzcholka spoza 0..vertexCount-1
+    GeneratorEdgeStream invalid{3, [](EdgeStream::EdgeInput &edge) {
+        edge = {0, 3, 1};
+        return true;
+    }};
+    REQUIRE_THROWS_AS(connectedComponents(invalid,component),std::out_of_range);
 }
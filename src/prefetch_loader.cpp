@@ -0,0 +1,117 @@
+#include "graphs/prefetch_loader.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+std::vector<std::filesystem::path> listDatasetFiles(const std::filesystem::path& directory,
+                                                    const std::string& extension)
+{
+    std::vector<std::filesystem::path> files;
+    for(const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        if(entry.is_regular_file() && (extension.empty() || entry.path().extension() == extension))
+            files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+template <typename W>
+BasicPrefetchLoader<W>::BasicPrefetchLoader(std::vector<std::filesystem::path> paths, std::size_t capacity)
+    : files(std::move(paths)), capacity(capacity)
+{
+    if(capacity == 0)
+    {
+        throw std::invalid_argument("Prefetch capacity must be positive");
+    }
+    worker = std::thread(&BasicPrefetchLoader::run, this);
+}
+
+template <typename W>
+BasicPrefetchLoader<W>::BasicPrefetchLoader(const std::filesystem::path& directory, const std::string& extension,
+                                            std::size_t capacity)
+    : BasicPrefetchLoader(listDatasetFiles(directory, extension), capacity)
+{
+}
+
+template <typename W>
+BasicPrefetchLoader<W>::~BasicPrefetchLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    slotFree.notify_all();
+    worker.join();
+}
+
+// Watek w tle: parsuje pliki po kolei poza blokada i czeka, gdy wszystkie miejsca sa zajete.
+// Miejsce jest rezerwowane przed parsowaniem i zwalniane dopiero, gdy next() przeniesie liste do wolajacego.
+template <typename W>
+void BasicPrefetchLoader<W>::run()
+{
+    for(const auto& path : files)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            slotFree.wait(lock, [this] { return stopping || reserved < capacity; });
+            if(stopping)
+                break;
+            ++reserved;
+        }
+
+        Slot slot{{path, {}}, nullptr};
+        try
+        {
+            slot.item.edgeList = loadEdgeList<W>(path);
+        }
+        catch(...)
+        {
+            slot.error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push_back(std::move(slot));
+        }
+        itemReady.notify_one();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        finished = true;
+    }
+    itemReady.notify_all();
+}
+
+// Złożoność czasowa: O(1) poza oczekiwaniem na wczytanie pliku, pamięciowa: O(1)
+template <typename W>
+bool BasicPrefetchLoader<W>::next(Item& item)
+{
+    Slot slot;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        itemReady.wait(lock, [this] { return finished || !queue.empty(); });
+        if(queue.empty())
+            return false;
+        slot = std::move(queue.front());
+        queue.pop_front();
+    }
+    std::exception_ptr error = slot.error;
+
+    // Poprzednia lista wolajacego jest zwalniana przed zwolnieniem miejsca dla kolejnego pliku
+    if(!error)
+        item = std::move(slot.item);
+    slot = Slot{};
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        --reserved;
+    }
+    slotFree.notify_one();
+
+    if(error)
+        std::rethrow_exception(error);
+    return true;
+}
+
+#define GRAPHS_INSTANTIATE_PREFETCH_LOADER(W) template class BasicPrefetchLoader<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_PREFETCH_LOADER)
@@ -0,0 +1,373 @@
+#include "graphs/result_io.hpp"
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "graphs/mapped_file.hpp"
+#include "graphs/text_cursor.hpp"
+
+namespace
+{
+constexpr char SHORTEST_PATH_MAGIC[8] = {'P', 'I', 'A', 'A', 'S', 'P', 'R', '\0'};
+constexpr char SPANNING_TREE_MAGIC[8] = {'P', 'I', 'A', 'A', 'M', 'S', 'T', '\0'};
+constexpr std::uint32_t VERSION = 1;
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+struct ResultHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint32_t valueType;
+    std::uint32_t reserved;
+    std::uint64_t count;      // liczba wierszy wyniku
+    std::uint64_t pathLength; // laczna dlugosc sciezek (tylko najkrotsze sciezki)
+};
+static_assert(sizeof(ResultHeader) == 40, "Result file header must be 40 bytes");
+
+// Tekst wyniku skladany w buforze i zapisywany do strumienia blokami po ok. 1 MB
+class TextWriter
+{
+    static constexpr std::size_t BLOCK_SIZE = 1 << 20;
+
+    std::ostream& os;
+    std::string buffer;
+
+  public:
+    explicit TextWriter(std::ostream& os) : os(os) { buffer.reserve(BLOCK_SIZE + 64); }
+    ~TextWriter() { flush(); }
+
+    template <typename T>
+    void put(T value, char separator)
+    {
+        char digits[64];
+        auto [next, ec] = std::to_chars(digits, digits + sizeof(digits), value);
+        buffer.append(digits, next);
+        buffer.push_back(separator);
+    }
+
+    void endLine()
+    {
+        buffer.back() = '\n';
+        if(buffer.size() >= BLOCK_SIZE)
+            flush();
+    }
+
+    void flush()
+    {
+        os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+};
+
+std::string readAll(std::istream& is)
+{
+    std::ostringstream text;
+    text << is.rdbuf();
+    return std::move(text).str();
+}
+
+std::ofstream openForWriting(const std::filesystem::path& path, std::ios::openmode mode)
+{
+    std::ofstream os(path, mode | std::ios::trunc);
+    if(!os)
+        throw std::runtime_error("Cannot write file: " + path.string());
+    return os;
+}
+
+void finishWriting(std::ofstream& os, const std::filesystem::path& path)
+{
+    if(!os.flush())
+        throw std::runtime_error("Cannot write file: " + path.string());
+}
+
+template <typename T>
+void writeArray(std::ostream& os, const std::vector<T>& values)
+{
+    os.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+template <typename T>
+void writeHeader(std::ostream& os, const char (&magic)[8], std::uint64_t count, std::uint64_t pathLength)
+{
+    ResultHeader header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.valueType = weightTypeCode<T>();
+    header.count = count;
+    header.pathLength = pathLength;
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+[[noreturn]] void throwInvalid(const std::filesystem::path& path, const char* reason)
+{
+    throw std::runtime_error("Invalid result file " + path.string() + ": " + reason);
+}
+
+// Sprawdza naglowek i rozmiar pliku; rowSize i pathSize to bajty na wiersz i na wierzcholek sciezki
+template <typename T>
+ResultHeader readHeader(const MappedFile& file, const std::filesystem::path& path, const char (&magic)[8],
+                        std::size_t rowSize, std::size_t fixedSize, std::size_t pathSize)
+{
+    ResultHeader header;
+    if(file.size() < sizeof(header))
+        throwInvalid(path, "file too short");
+    std::memcpy(&header, file.data(), sizeof(header));
+    if(std::memcmp(header.magic, magic, sizeof(magic)) != 0)
+        throwInvalid(path, "unexpected file type");
+    if(header.version != VERSION)
+        throwInvalid(path, "unsupported version");
+    if(header.byteOrder != BYTE_ORDER_MARK)
+        throwInvalid(path, "byte order mismatch");
+    if(header.valueType != weightTypeCode<T>())
+        throwInvalid(path, "value type mismatch");
+
+    std::size_t payload = file.size() - sizeof(header);
+    if(header.count > payload / rowSize || header.pathLength > payload ||
+       payload != header.count * rowSize + fixedSize + header.pathLength * pathSize)
+        throwInvalid(path, "file size does not match header");
+    return header;
+}
+
+// Kopiuje count elementow z pozycji data i przesuwa ja za nie
+template <typename T>
+std::vector<T> readArray(const char*& data, std::size_t count)
+{
+    std::vector<T> values(count);
+    std::memcpy(values.data(), data, count * sizeof(T));
+    data += count * sizeof(T);
+    return values;
+}
+} // namespace
+
+// Złożoność czasowa: O(rozmiar wyniku), pamięciowa: O(1) poza buforem
+template <typename D>
+void writeShortestPathResult(std::ostream& os, const BasicShortestPathResult<D>& result)
+{
+    TextWriter writer(os);
+    for(const auto& [endVertex, value] : result)
+    {
+        writer.put(endVertex, ' ');
+        writer.put(value.first, ' ');
+        for(int v : value.second)
+        {
+            writer.put(v, ' ');
+        }
+        writer.endLine();
+    }
+}
+
+// Złożoność czasowa: O(rozmiar wejscia + V log V), pamięciowa: O(rozmiar wyniku)
+template <typename D>
+BasicShortestPathResult<D> parseShortestPathResult(const char* begin, const char* end)
+{
+    TextCursor cursor(begin, end);
+    BasicShortestPathResult<D> result;
+    while(!cursor.atEnd())
+    {
+        int endVertex = cursor.read<int>("end vertex");
+        D cost = cursor.read<D>("path cost");
+        std::vector<int> path;
+        while(!cursor.atLineEnd())
+        {
+            path.push_back(cursor.read<int>("path vertex"));
+        }
+        result.insert_or_assign(endVertex, std::make_pair(cost, std::move(path)));
+    }
+    return result;
+}
+
+template <typename D>
+void readShortestPathResult(std::istream& is, BasicShortestPathResult<D>& result)
+{
+    std::string text = readAll(is);
+    result = parseShortestPathResult<D>(text.data(), text.data() + text.size());
+}
+
+template <typename D>
+void saveShortestPathResult(const BasicShortestPathResult<D>& result, const std::filesystem::path& path)
+{
+    std::ofstream os = openForWriting(path, std::ios::out);
+    writeShortestPathResult(os, result);
+    finishWriting(os, path);
+}
+
+template <typename D>
+BasicShortestPathResult<D> loadShortestPathResult(const std::filesystem::path& path)
+{
+    MappedFile file(path);
+    return parseShortestPathResult<D>(file.begin(), file.end());
+}
+
+// Kolumny: wierzcholki koncowe (int32), koszty (D), przesuniecia sciezek (uint64, n + 1), wierzcholki sciezek.
+// Złożoność czasowa: O(rozmiar wyniku), pamięciowa: O(rozmiar wyniku)
+template <typename D>
+void saveShortestPathResultBinary(const BasicShortestPathResult<D>& result, const std::filesystem::path& path)
+{
+    std::vector<int> endVertices;
+    std::vector<D> costs;
+    std::vector<std::uint64_t> pathOffsets{0};
+    std::vector<int> pathVertices;
+    endVertices.reserve(result.size());
+    costs.reserve(result.size());
+    pathOffsets.reserve(result.size() + 1);
+    for(const auto& [endVertex, value] : result)
+    {
+        endVertices.push_back(endVertex);
+        costs.push_back(value.first);
+        pathVertices.insert(pathVertices.end(), value.second.begin(), value.second.end());
+        pathOffsets.push_back(pathVertices.size());
+    }
+
+    std::ofstream os = openForWriting(path, std::ios::binary);
+    writeHeader<D>(os, SHORTEST_PATH_MAGIC, result.size(), pathVertices.size());
+    writeArray(os, endVertices);
+    writeArray(os, costs);
+    writeArray(os, pathOffsets);
+    writeArray(os, pathVertices);
+    finishWriting(os, path);
+}
+
+// Złożoność czasowa: O(rozmiar wyniku), pamięciowa: O(rozmiar wyniku)
+template <typename D>
+BasicShortestPathResult<D> loadShortestPathResultBinary(const std::filesystem::path& path)
+{
+    MappedFile file(path);
+    ResultHeader header = readHeader<D>(file, path, SHORTEST_PATH_MAGIC, sizeof(int) + sizeof(D) + 8, 8, sizeof(int));
+
+    const char* data = file.data() + sizeof(header);
+    auto endVertices = readArray<int>(data, header.count);
+    auto costs = readArray<D>(data, header.count);
+    auto pathOffsets = readArray<std::uint64_t>(data, header.count + 1);
+    const char* pathVertices = data;
+
+    BasicShortestPathResult<D> result;
+    for(std::size_t i = 0; i < header.count; ++i)
+    {
+        if(pathOffsets[i] > pathOffsets[i + 1] || pathOffsets[i + 1] > header.pathLength)
+            throwInvalid(path, "invalid path offsets");
+
+        std::vector<int> vertices(pathOffsets[i + 1] - pathOffsets[i]);
+        std::memcpy(vertices.data(), pathVertices + pathOffsets[i] * sizeof(int), vertices.size() * sizeof(int));
+        result.emplace_hint(result.end(), endVertices[i], std::make_pair(costs[i], std::move(vertices)));
+    }
+    return result;
+}
+
+// Złożoność czasowa: O(E), pamięciowa: O(1) poza buforem
+template <typename W>
+void writeMstResult(std::ostream& os, const BasicMinimumSpanningTreeResult<W>& result)
+{
+    TextWriter writer(os);
+    for(const auto& edge : result)
+    {
+        writer.put(edge.v1, ' ');
+        writer.put(edge.v2, ' ');
+        writer.put(edge.weight, ' ');
+        writer.endLine();
+    }
+}
+
+// Złożoność czasowa: O(rozmiar wejscia), pamięciowa: O(E)
+template <typename W>
+BasicMinimumSpanningTreeResult<W> parseMstResult(const char* begin, const char* end)
+{
+    TextCursor cursor(begin, end);
+    BasicMinimumSpanningTreeResult<W> result;
+    while(!cursor.atEnd())
+    {
+        BasicMinimumSpanningEdge<W> edge;
+        edge.v1 = cursor.read<int>("start vertex");
+        edge.v2 = cursor.read<int>("end vertex");
+        edge.weight = cursor.read<W>("edge weight");
+        result.push_back(edge);
+    }
+    return result;
+}
+
+template <typename W>
+void readMstResult(std::istream& is, BasicMinimumSpanningTreeResult<W>& result)
+{
+    std::string text = readAll(is);
+    result = parseMstResult<W>(text.data(), text.data() + text.size());
+}
+
+template <typename W>
+void saveMstResult(const BasicMinimumSpanningTreeResult<W>& result, const std::filesystem::path& path)
+{
+    std::ofstream os = openForWriting(path, std::ios::out);
+    writeMstResult(os, result);
+    finishWriting(os, path);
+}
+
+template <typename W>
+BasicMinimumSpanningTreeResult<W> loadMstResult(const std::filesystem::path& path)
+{
+    MappedFile file(path);
+    return parseMstResult<W>(file.begin(), file.end());
+}
+
+// Kolumny: poczatki krawedzi (int32), konce (int32), wagi (W).
+// Złożoność czasowa: O(E), pamięciowa: O(E)
+template <typename W>
+void saveMstResultBinary(const BasicMinimumSpanningTreeResult<W>& result, const std::filesystem::path& path)
+{
+    std::vector<int> starts, ends;
+    std::vector<W> weights;
+    starts.reserve(result.size());
+    ends.reserve(result.size());
+    weights.reserve(result.size());
+    for(const auto& edge : result)
+    {
+        starts.push_back(edge.v1);
+        ends.push_back(edge.v2);
+        weights.push_back(edge.weight);
+    }
+
+    std::ofstream os = openForWriting(path, std::ios::binary);
+    writeHeader<W>(os, SPANNING_TREE_MAGIC, result.size(), 0);
+    writeArray(os, starts);
+    writeArray(os, ends);
+    writeArray(os, weights);
+    finishWriting(os, path);
+}
+
+// Złożoność czasowa: O(E), pamięciowa: O(E)
+template <typename W>
+BasicMinimumSpanningTreeResult<W> loadMstResultBinary(const std::filesystem::path& path)
+{
+    MappedFile file(path);
+    ResultHeader header = readHeader<W>(file, path, SPANNING_TREE_MAGIC, 2 * sizeof(int) + sizeof(W), 0, 0);
+
+    const char* data = file.data() + sizeof(header);
+    auto starts = readArray<int>(data, header.count);
+    auto ends = readArray<int>(data, header.count);
+    auto weights = readArray<W>(data, header.count);
+
+    BasicMinimumSpanningTreeResult<W> result(header.count);
+    for(std::size_t i = 0; i < header.count; ++i)
+    {
+        result[i] = {starts[i], ends[i], weights[i]};
+    }
+    return result;
+}
+
+#define GRAPHS_INSTANTIATE_RESULT_IO(T)                                                                                \
+    template void writeShortestPathResult(std::ostream&, const BasicShortestPathResult<T>&);                          \
+    template void readShortestPathResult(std::istream&, BasicShortestPathResult<T>&);                                 \
+    template BasicShortestPathResult<T> parseShortestPathResult(const char*, const char*);                            \
+    template void saveShortestPathResult(const BasicShortestPathResult<T>&, const std::filesystem::path&);            \
+    template BasicShortestPathResult<T> loadShortestPathResult(const std::filesystem::path&);                         \
+    template void saveShortestPathResultBinary(const BasicShortestPathResult<T>&, const std::filesystem::path&);      \
+    template BasicShortestPathResult<T> loadShortestPathResultBinary(const std::filesystem::path&);                   \
+    template void writeMstResult(std::ostream&, const BasicMinimumSpanningTreeResult<T>&);                            \
+    template void readMstResult(std::istream&, BasicMinimumSpanningTreeResult<T>&);                                   \
+    template BasicMinimumSpanningTreeResult<T> parseMstResult(const char*, const char*);                              \
+    template void saveMstResult(const BasicMinimumSpanningTreeResult<T>&, const std::filesystem::path&);              \
+    template BasicMinimumSpanningTreeResult<T> loadMstResult(const std::filesystem::path&);                           \
+    template void saveMstResultBinary(const BasicMinimumSpanningTreeResult<T>&, const std::filesystem::path&);        \
+    template BasicMinimumSpanningTreeResult<T> loadMstResultBinary(const std::filesystem::path&);
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_RESULT_IO)
@@ -1,12 +1,724 @@
 #include "graphs/shortest_path_algorithms.hpp"
+#include "graphs/compressed_graph.hpp"
+#include "graphs/csr_graph.hpp"
+#include "graphs/bucket_queues.hpp"
+#include "graphs/indexed_heap.hpp"
+#include "graphs/succinct_graph.hpp"
 
-void dijkstra(Graph& graph, int sourceIndex, ShortestPathResult& result)
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace
+{
+// Zrodla sasiadow dla algorytmow ponizej (po gestych indeksach wierzcholkow): forEachOut(u, f) i forEachIn(u, f)
+// wywoluja f(sasiad, waga), weightAt(i) to waga i-tej krawedzi (0..m-1, dowolna kolejnosc).
+// Graf CSR czyta zakresy slotow.
+template <typename W>
+class CsrNeighbors
+{
+    const BasicCsrGraph<W>& csr;
+
+  public:
+    using Weight = W;
+
+    explicit CsrNeighbors(const BasicCsrGraph<W>& csr) : csr(csr) {}
+
+    int numVertices() const { return csr.numVertices(); }
+    int numEdges() const { return csr.numEdges(); }
+    bool isDirected() const { return csr.isDirected(); }
+    int indexOf(int v) const { return csr.indexOf(v); }
+    int vertexAt(int index) const { return csr.vertexAt(index); }
+    W weightAt(int slot) const { return csr.weight(slot); }
+
+    template <typename F>
+    void forEachOut(int u, F&& f) const
+    {
+        for(int slot = csr.outBegin(u); slot < csr.outEnd(u); ++slot)
+        {
+            f(csr.target(slot), csr.weight(slot));
+        }
+    }
+
+    template <typename F>
+    void forEachIn(int u, F&& f) const
+    {
+        for(int i = csr.inBegin(u); i < csr.inEnd(u); ++i)
+        {
+            int slot = csr.inSlot(i);
+            f(csr.source(slot), csr.weight(slot));
+        }
+    }
+};
+
+// Grafy tylko do odczytu (CompressedGraph, SuccinctGraph) dekoduja nastepnikow kursorem w miejscu, bez kopii CSR.
+// Sa zawsze skierowane, wiec Dijkstra i Bellman-Ford w przod uzywaja tylko forEachOut.
+template <typename Graph>
+class CursorNeighbors
+{
+    const Graph& graph;
+
+  public:
+    using Weight = decltype(std::declval<const Graph&>().weight(0));
+
+    explicit CursorNeighbors(const Graph& graph) : graph(graph) {}
+
+    int numVertices() const { return graph.numVertices(); }
+    int numEdges() const { return graph.numEdges(); }
+    bool isDirected() const { return graph.isDirected(); }
+    int indexOf(int v) const { return graph.indexOf(v); }
+    int vertexAt(int index) const { return graph.vertexAt(index); }
+    Weight weightAt(int e) const { return graph.weight(e); }
+
+    template <typename F>
+    void forEachOut(int u, F&& f) const
+    {
+        for(auto cursor = graph.neighbors(u); cursor.next();)
+        {
+            f(cursor.target(), graph.weight(cursor.edge()));
+        }
+    }
+
+    template <typename F>
+    void forEachIn(int u, F&& f) const
+    {
+        graph.forEachInNeighbor(graph.vertexAt(u), [this, &f](int v, int, Weight w) { f(graph.indexOf(v), w); });
+    }
+};
+
+// Wywoluje run(sasiedzi) na grafie: grafy tylko do odczytu bezposrednio, pozostale przez asCsr (bez kopii dla CSR).
+template <typename W, typename Run>
+auto withNeighbors(const BasicGraph<W>& graph, Run&& run)
+{
+    if(auto* compressed = dynamic_cast<const BasicCompressedGraph<W>*>(&graph))
+        return run(CursorNeighbors<BasicCompressedGraph<W>>(*compressed));
+    if(auto* succinct = dynamic_cast<const BasicSuccinctGraph<W>*>(&graph))
+        return run(CursorNeighbors<BasicSuccinctGraph<W>>(*succinct));
+
+    std::unique_ptr<BasicCsrGraph<W>> storage;
+    return run(CsrNeighbors<W>(asCsr(graph, storage)));
+}
+
+// Sklada drzewo najkrotszych sciezek z tablic odleglosci i poprzednikow (po gestych indeksach).
+// Złożoność czasowa: O(V), pamięciowa: O(V)
+template <typename Neighbors, typename D>
+BasicShortestPathTree<D> makeTree(const Neighbors& graph, int source, std::vector<D>& distance,
+                                  std::vector<int>& predecessor)
+{
+    std::vector<int> ids(graph.numVertices());
+    for(int v = 0; v < graph.numVertices(); ++v)
+    {
+        ids[v] = graph.vertexAt(v);
+    }
+    return {std::move(ids), source, std::move(distance), std::move(predecessor)};
+}
+
+// Potencjal zerowy: klucz w kolejce rowny odleglosci, czyli zwykly algorytm Dijkstry
+struct ZeroPotential
+{
+    int operator()(int) const { return 0; }
+};
+
+// Algorytm Dijkstry na zrodle sasiadow graph z kolejka Queue (interfejs IndexedHeap).
+// Kazdy wierzcholek jest w kolejce co najwyzej raz: poprawa odleglosci to decreaseKey, a nie nowy wpis.
+// Wierzcholek zdjety z kolejki nie jest juz poprawiany. Konczy sie po zdjeciu target (-1 - przeglada caly graf);
+// zwraca liczbe zdjetych wierzcholkow. backward przeszukuje graf odwrocony (odleglosci do zrodla).
+// Kluczem w kolejce jest odleglosc plus potential(v) (A*); potencjal musi byc spojny, a infiniteDistance<D>()
+// oznacza wierzcholek, z ktorego cel jest nieosiagalny - taki wierzcholek nie trafia do kolejki.
+template <typename Neighbors, typename D, typename Queue, typename Potential = ZeroPotential>
+int runDijkstra(const Neighbors& graph, int source, Queue& queue, std::vector<D>& distance,
+                std::vector<int>& predecessor, int target = -1, bool backward = false,
+                const Potential& potential = {})
+{
+    constexpr D INF = infiniteDistance<D>();
+    D sourcePotential = static_cast<D>(potential(source));
+    if(sourcePotential == INF)
+        return 0;
+
+    distance[source] = 0;
+    queue.push(source, sourcePotential);
+
+    auto relax = [&](int u, int v, typename Neighbors::Weight weight) {
+        D candidate = distance[u] + static_cast<D>(weight);
+        if(!(candidate < distance[v]))
+            return;
+
+        D vertexPotential = static_cast<D>(potential(v));
+        if(vertexPotential == INF)
+            return;
+        if(queue.contains(v))
+            queue.decreaseKey(v, candidate + vertexPotential);
+        else if(!queue.wasRemoved(v))
+            queue.push(v, candidate + vertexPotential);
+        else
+            return;
+        distance[v] = candidate;
+        predecessor[v] = u;
+    };
+
+    // W grafie nieskierowanym krawedz jest zapisana raz, wiec relaksowana jest w obu kierunkach
+    int settled = 0;
+    while(!queue.empty())
+    {
+        int u = queue.pop();
+        ++settled;
+        if(u == target)
+            break;
+
+        auto relaxFromU = [&relax, u](int v, typename Neighbors::Weight weight) { relax(u, v, weight); };
+        if(!backward || !graph.isDirected())
+            graph.forEachOut(u, relaxFromU);
+        if(backward || !graph.isDirected())
+            graph.forEachIn(u, relaxFromU);
+    }
+    return settled;
+}
+
+// Odleglosci ze zrodla (backward - do zrodla) do wszystkich wierzcholkow z kolejka wybrana jak w dijkstra.
+// Złożoność czasowa: jak wybranej kolejki, pamięciowa: O(V + C) dla BucketQueue, O(V) dla pozostalych
+template <typename Neighbors, typename D>
+void dijkstraDistances(const Neighbors& graph, int source, DijkstraQueue queueKind, std::vector<D>& distance,
+                       std::vector<int>& predecessor, bool backward = false)
+{
+    using W = typename Neighbors::Weight;
+    int n = graph.numVertices();
+    distance.assign(n, infiniteDistance<D>());
+    predecessor.assign(n, -1);
+
+    if constexpr(std::is_integral_v<W>)
+    {
+        W minWeight = 0, maxWeight = 0;
+        for(int e = 0; e < graph.numEdges(); ++e)
+        {
+            minWeight = std::min(minWeight, graph.weightAt(e));
+            maxWeight = std::max(maxWeight, graph.weightAt(e));
+        }
+        bool integerWeights = minWeight >= 0;
+
+        if(queueKind == DijkstraQueue::Automatic && integerWeights)
+        {
+            queueKind = static_cast<std::uint64_t>(maxWeight) <= GRAPHS_DIAL_MAX_WEIGHT ? DijkstraQueue::BucketQueue
+                                                                                        : DijkstraQueue::RadixHeap;
+        }
+        if(queueKind == DijkstraQueue::BucketQueue || queueKind == DijkstraQueue::RadixHeap)
+        {
+            if(!integerWeights)
+            {
+                throw std::invalid_argument("Bucket queues require non-negative integer weights");
+            }
+            if(queueKind == DijkstraQueue::BucketQueue)
+            {
+                BucketQueue<D> queue(n, static_cast<D>(maxWeight));
+                runDijkstra(graph, source, queue, distance, predecessor, -1, backward);
+            }
+            else
+            {
+                RadixHeap<D> queue(n);
+                runDijkstra(graph, source, queue, distance, predecessor, -1, backward);
+            }
+            return;
+        }
+    }
+    else if(queueKind == DijkstraQueue::BucketQueue || queueKind == DijkstraQueue::RadixHeap)
+    {
+        throw std::invalid_argument("Bucket queues require non-negative integer weights");
+    }
+
+    IndexedHeap<D, GRAPHS_DIJKSTRA_HEAP_ARITY> queue(n);
+    runDijkstra(graph, source, queue, distance, predecessor, -1, backward);
+}
+
+// Kolejka przekazujaca wywolania do queue i zapisujaca wstawiane wierzcholki w pushed - tylko tym wierzcholkom
+// przeszukiwanie zmienia odleglosci, wiec tylko je trzeba potem przywrocic.
+template <typename Queue>
+class TrackingQueue
+{
+    Queue& queue;
+    std::vector<int>& pushed;
+
+  public:
+    TrackingQueue(Queue& queue, std::vector<int>& pushed) : queue(queue), pushed(pushed) {}
+
+    bool empty() const { return queue.empty(); }
+    bool contains(int item) const { return queue.contains(item); }
+    bool wasRemoved(int item) const { return queue.wasRemoved(item); }
+
+    template <typename Key>
+    void push(int item, Key key)
+    {
+        pushed.push_back(item);
+        queue.push(item, key);
+    }
+
+    template <typename Key>
+    void decreaseKey(int item, Key key)
+    {
+        queue.decreaseKey(item, key);
+    }
+
+    int pop() { return queue.pop(); }
+};
+
+// Przepisuje sciezke do target z tablic poprzednikow; false, gdy target jest nieosiagalny.
+// Złożoność czasowa: O(dlugosc sciezki), pamięciowa: O(dlugosc sciezki)
+template <typename Neighbors, typename D>
+bool extractPath(const Neighbors& graph, int target, const std::vector<D>& distance,
+                 const std::vector<int>& predecessor, BasicShortestPath<D>& path)
+{
+    if(distance[target] == infiniteDistance<D>())
+        return false;
+
+    path.distance = distance[target];
+    for(int u = target; u != -1; u = predecessor[u])
+    {
+        path.vertices.push_back(graph.vertexAt(u));
+    }
+    std::reverse(path.vertices.begin(), path.vertices.end());
+    return true;
+}
+
+// Punkty orientacyjne wybierane zachlannie "najdalszy od wybranych": pierwszy to wierzcholek najdalszy od
+// wierzcholka o indeksie 0, kazdy kolejny to wierzcholek o najwiekszej odleglosci (w dowolnym kierunku) od
+// najblizszego juz wybranego punktu. Wierzcholki niepolaczone z zadnym punktem sa wybierane najpierw, wiec
+// kazda skladowa dostaje punkt. Wierzcholki bez krawedzi sa pomijane, dopoki sa inne do wyboru: punkt
+// izolowany nie daje zadnego ograniczenia, a bez tego k izolowanych wierzcholkow zabraloby wszystkie punkty.
+// Dla kazdego punktu liczone sa dwa pelne przebiegi Dijkstry (w przod i wstecz, w grafie nieskierowanym jeden)
+// z kolejka wybrana jak w dijkstra z DijkstraQueue::Automatic.
+// Złożoność czasowa: O(k * (E + V log V)), pamięciowa: O(k * V)
+template <typename W, typename D>
+void selectLandmarks(const BasicCsrGraph<W>& csr, int count, BasicLandmarks<D>& landmarks)
+{
+    if(count < 0)
+    {
+        throw std::invalid_argument("Landmark count must not be negative");
+    }
+
+    constexpr D INF = infiniteDistance<D>();
+    int n = csr.numVertices();
+    int k = std::min(count, n);
+    bool directed = csr.isDirected();
+    landmarks = {};
+    landmarks.numVertices = n;
+    landmarks.fromLandmark.assign(static_cast<std::size_t>(n) * k, INF);
+    if(directed)
+        landmarks.toLandmark.assign(static_cast<std::size_t>(n) * k, INF);
+    if(k == 0)
+        return;
+
+    // score[v] - odleglosc v od najblizszego wybranego punktu w dowolnym kierunku
+    std::vector<D> score(n, INF);
+    std::vector<D> from, to;
+    std::vector<int> predecessor;
+    auto updateScore = [&](int vertex) {
+        dijkstraDistances(CsrNeighbors<W>(csr), vertex, DijkstraQueue::Automatic, from, predecessor);
+        if(directed)
+            dijkstraDistances(CsrNeighbors<W>(csr), vertex, DijkstraQueue::Automatic, to, predecessor, true);
+        for(int v = 0; v < n; ++v)
+        {
+            score[v] = std::min({score[v], from[v], directed ? to[v] : from[v]});
+        }
+    };
+    auto isolated = [&csr](int v) { return csr.outBegin(v) == csr.outEnd(v) && csr.inBegin(v) == csr.inEnd(v); };
+    auto farthest = [&]() {
+        int best = -1;
+        for(int v = 0; v < n; ++v)
+        {
+            if(!isolated(v) && score[v] >= 0 && (best == -1 || score[best] < score[v]))
+                best = v;
+        }
+        // Same wierzcholki izolowane (albo wszystkie inne juz wybrane)
+        for(int v = 0; best == -1; ++v)
+        {
+            if(score[v] >= 0)
+                best = v;
+        }
+        return best;
+    };
+
+    updateScore(0);
+    int landmark = farthest();
+    std::fill(score.begin(), score.end(), INF);
+    for(int l = 0; l < k; ++l)
+    {
+        landmarks.vertices.push_back(csr.vertexAt(landmark));
+        updateScore(landmark);
+        score[landmark] = -1; // wybrany punkt nie moze byc wybrany ponownie
+        for(int v = 0; v < n; ++v)
+        {
+            landmarks.fromLandmark[static_cast<std::size_t>(v) * k + l] = from[v];
+            if(directed)
+                landmarks.toLandmark[static_cast<std::size_t>(v) * k + l] = to[v];
+        }
+        if(l + 1 < k)
+            landmark = farthest();
+    }
+}
+
+// A* z heurystyka ALT: dla punktu l z nierownosci trojkata d(v, t) >= d(l, t) - d(l, v) oraz
+// d(v, t) >= d(v, l) - d(t, l); heurystyka to maksimum tych ograniczen (co najmniej 0), wiec jest spojna
+// i zapytanie konczy sie po zdjeciu celu z kolejki. Ograniczenie z nieskonczona odlegloscia jest pomijane,
+// chyba ze dowodzi, ze cel jest z v nieosiagalny - wtedy v nie trafia do kolejki. Zwraca liczbe zdjetych
+// wierzcholkow.
+// Złożoność czasowa: O(k * E' + E' log_d V'), zwykle dla duzo mniejszych V', E' niz Dijkstra, pamięciowa: O(1)
+template <typename W, typename D, typename Queue>
+int runAStar(const BasicCsrGraph<W>& csr, const BasicLandmarks<D>& landmarks, int source, int target, Queue& queue,
+             std::vector<D>& distance, std::vector<int>& predecessor)
+{
+    constexpr D INF = infiniteDistance<D>();
+    if(landmarks.numVertices != csr.numVertices())
+    {
+        throw std::invalid_argument("Landmarks were computed for a different graph");
+    }
+
+    std::size_t k = landmarks.vertices.size();
+    const D* from = landmarks.fromLandmark.data();
+    const D* to = landmarks.toLandmark.empty() ? from : landmarks.toLandmark.data();
+    const D* fromTarget = from + static_cast<std::size_t>(target) * k;
+    const D* toTarget = to + static_cast<std::size_t>(target) * k;
+
+    auto potential = [&](int v) {
+        const D* fromV = from + static_cast<std::size_t>(v) * k;
+        const D* toV = to + static_cast<std::size_t>(v) * k;
+        D bound = 0;
+        for(std::size_t l = 0; l < k; ++l)
+        {
+            // l osiaga v, ale nie t, albo t osiaga l, ale v nie - wtedy v nie osiaga t
+            if((fromV[l] != INF && fromTarget[l] == INF) || (toV[l] == INF && toTarget[l] != INF))
+                return INF;
+            if(fromV[l] != INF && fromTarget[l] - fromV[l] > bound)
+                bound = fromTarget[l] - fromV[l];
+            if(toV[l] != INF && toV[l] - toTarget[l] > bound)
+                bound = toV[l] - toTarget[l];
+        }
+        return bound;
+    };
+    return runDijkstra(CsrNeighbors<W>(csr), source, queue, distance, predecessor, target, false, potential);
+}
+} // namespace
+
+// Algorytm Dijkstry na reprezentacji CSR albo bezposrednio na grafie tylko do odczytu. Kolejka priorytetowa:
+//   DaryHeap - indeksowany kopiec d-arny (GRAPHS_DIJKSTRA_HEAP_ARITY), O(E log_d V),
+//   BucketQueue - kolejka kubelkowa Diala, O(E + V * C) dla wag 0..C,
+//   RadixHeap - kopiec pozycyjny, O(E + V log C),
+//   Automatic - kolejka Diala dla calkowitych wag 0..GRAPHS_DIAL_MAX_WEIGHT, kopiec pozycyjny dla wiekszych
+//   nieujemnych wag calkowitych, kopiec d-arny w pozostalych przypadkach.
+// BucketQueue i RadixHeap wymagaja nieujemnych wag calkowitych (std::invalid_argument).
+// Złożoność czasowa: jak wybranej kolejki, pamięciowa: O(V + C) dla BucketQueue, O(V) dla pozostalych
+template <typename W, typename D>
+void dijkstra(BasicGraph<W>& graph, int sourceIndex, BasicShortestPathTree<D>& tree, DijkstraQueue queueKind)
+{
+    withNeighbors(graph, [&](const auto& neighbors) {
+        int source = neighbors.indexOf(sourceIndex);
+        std::vector<D> distance;
+        std::vector<int> predecessor;
+        dijkstraDistances(neighbors, source, queueKind, distance, predecessor);
+        tree = makeTree(neighbors, source, distance, predecessor);
+    });
+}
+
+// Złożoność czasowa: jak dijkstra z drzewem + O(V * glebokosc drzewa), pamięciowa: O(V * glebokosc drzewa)
+template <typename W, typename D>
+void dijkstra(BasicGraph<W>& graph, int sourceIndex, BasicShortestPathResult<D>& result, DijkstraQueue queue)
+{
+    BasicShortestPathTree<D> tree;
+    dijkstra(graph, sourceIndex, tree, queue);
+    result = tree.toMap();
+}
+
+// Złożoność czasowa: O(V), pamięciowa: O(V)
+template <typename W, typename D>
+BasicShortestPathQuery<W, D>::BasicShortestPathQuery(const BasicCsrGraph<W>& graph)
+    : csr(graph),
+      distance{std::vector<D>(graph.numVertices(), infiniteDistance<D>()),
+               std::vector<D>(graph.numVertices(), infiniteDistance<D>())},
+      link{std::vector<int>(graph.numVertices(), -1), std::vector<int>(graph.numVertices(), -1)},
+      queues{Heap(graph.numVertices()), Heap(graph.numVertices())}
+{
+    landmarkSet.numVertices = graph.numVertices();
+}
+
+// Przywraca odleglosci, dowiazania i kopce wierzcholkow dotknietych przez poprzednie zapytanie.
+// Złożoność czasowa: O(liczba dotknietych wierzcholkow), pamięciowa: O(1)
+template <typename W, typename D>
+void BasicShortestPathQuery<W, D>::reset()
+{
+    for(int side = 0; side < 2; ++side)
+    {
+        for(int v : touched[side])
+        {
+            distance[side][v] = infiniteDistance<D>();
+            link[side][v] = -1;
+        }
+        queues[side].reset(touched[side]);
+        touched[side].clear();
+    }
+}
+
+// Dijkstra ze zrodla konczacy sie po zdjeciu celu z kopca d-arnego. Kolejki kubelkowe nie sa tu uzywane, bo
+// ich wybor wymaga przejrzenia wszystkich wag (O(E)), co przy jednym zapytaniu kosztowaloby wiecej niz ono samo.
+// Złożoność czasowa: O(E' log_d V'), V' i E' - wierzcholki blizsze niz cel i ich krawedzie, pamięciowa: O(V')
+template <typename W, typename D>
+bool BasicShortestPathQuery<W, D>::shortestPath(int sourceIndex, int targetIndex, BasicShortestPath<D>& path)
+{
+    int source = csr.indexOf(sourceIndex);
+    int target = csr.indexOf(targetIndex);
+    reset();
+
+    TrackingQueue<Heap> queue(queues[0], touched[0]);
+    path = {};
+    path.settledVertices = runDijkstra(CsrNeighbors<W>(csr), source, queue, distance[0], link[0], target);
+    return extractPath(csr, target, distance[0], link[0], path);
+}
+
+// Dwukierunkowy Dijkstra: na zmiane (strona o mniejszym kluczu na szczycie kopca) przeszukiwanie w przod
+// po krawedziach wychodzacych ze zrodla i wstecz po krawedziach wchodzacych do celu. best to najkrotsza
+// znaleziona sciezka przez wierzcholek osiagniety z obu stron; gdy suma kluczy na szczytach obu kopcow
+// jest nie mniejsza niz best, zadna krotsza sciezka juz nie istnieje. Wagi musza byc nieujemne.
+// Złożoność czasowa: O(E' log_d V'), zwykle dla mniejszych V', E' niz shortestPath, pamięciowa: O(V')
+template <typename W, typename D>
+bool BasicShortestPathQuery<W, D>::bidirectionalShortestPath(int sourceIndex, int targetIndex,
+                                                             BasicShortestPath<D>& path)
+{
+    constexpr D INF = infiniteDistance<D>();
+    int source = csr.indexOf(sourceIndex);
+    int target = csr.indexOf(targetIndex);
+    reset();
+
+    distance[0][source] = 0;
+    distance[1][target] = 0;
+    queues[0].push(source, 0);
+    queues[1].push(target, 0);
+    touched[0].push_back(source);
+    touched[1].push_back(target);
+
+    D best = source == target ? 0 : INF;
+    int meeting = source == target ? source : -1;
+
+    auto relax = [&](int side, int u, int v, int slot) {
+        D candidate = distance[side][u] + static_cast<D>(csr.weight(slot));
+        if(!(candidate < distance[side][v]))
+            return;
+
+        auto& queue = queues[side];
+        if(queue.contains(v))
+        {
+            queue.decreaseKey(v, candidate);
+        }
+        else if(!queue.wasRemoved(v))
+        {
+            queue.push(v, candidate);
+            touched[side].push_back(v);
+        }
+        else
+        {
+            return;
+        }
+        distance[side][v] = candidate;
+        link[side][v] = u;
+
+        if(distance[1 - side][v] != INF && candidate + distance[1 - side][v] < best)
+        {
+            best = candidate + distance[1 - side][v];
+            meeting = v;
+        }
+    };
+
+    path = {};
+    while(!queues[0].empty() && !queues[1].empty() && queues[0].topKey() + queues[1].topKey() < best)
+    {
+        int side = queues[0].topKey() <= queues[1].topKey() ? 0 : 1;
+        int u = queues[side].pop();
+        ++path.settledVertices;
+
+        // W przod: krawedzie wychodzace; wstecz: wchodzace; w grafie nieskierowanym obie strony uzywaja obu
+        if(side == 0 || !csr.isDirected())
+        {
+            for(int slot = csr.outBegin(u); slot < csr.outEnd(u); ++slot)
+            {
+                relax(side, u, csr.target(slot), slot);
+            }
+        }
+        if(side == 1 || !csr.isDirected())
+        {
+            for(int i = csr.inBegin(u); i < csr.inEnd(u); ++i)
+            {
+                relax(side, u, csr.source(csr.inSlot(i)), csr.inSlot(i));
+            }
+        }
+    }
+
+    if(meeting == -1)
+        return false;
+
+    path.distance = best;
+    for(int u = meeting; u != -1; u = link[0][u])
+    {
+        path.vertices.push_back(csr.vertexAt(u));
+    }
+    std::reverse(path.vertices.begin(), path.vertices.end());
+    for(int u = link[1][meeting]; u != -1; u = link[1][u])
+    {
+        path.vertices.push_back(csr.vertexAt(u));
+    }
+    return true;
+}
+
+// Pojedyncze zapytanie: tablice zapytania sa alokowane dla tego jednego wywolania, graf listowy i macierzowy
+// jest najpierw kopiowany do CSR, a grafy tylko do odczytu sa przegladane w miejscu; dla wielu zapytan na
+// jednym grafie sluzy BasicShortestPathQuery.
+// Złożoność czasowa: O(V) + zapytania (O(V + E log E) dla kopii do CSR), pamięciowa: O(V)
+template <typename W, typename D>
+bool shortestPath(BasicGraph<W>& graph, int sourceIndex, int targetIndex, BasicShortestPath<D>& path)
 {
-    // TODO: implement
+    return withNeighbors(graph, [&](const auto& neighbors) {
+        int n = neighbors.numVertices();
+        int source = neighbors.indexOf(sourceIndex);
+        int target = neighbors.indexOf(targetIndex);
+        std::vector<D> distance(n, infiniteDistance<D>());
+        std::vector<int> predecessor(n, -1);
+        IndexedHeap<D, GRAPHS_DIJKSTRA_HEAP_ARITY> queue(n);
+        path = {};
+        path.settledVertices = runDijkstra(neighbors, source, queue, distance, predecessor, target);
+        return extractPath(neighbors, target, distance, predecessor, path);
+    });
 }
 
-bool bellmanFord(Graph& graph, int sourceIndex, ShortestPathResult& result)
+// Złożoność czasowa: O(V) + zapytania (O(V + E log E) dla grafu spoza CSR), pamięciowa: O(V)
+template <typename W, typename D>
+bool bidirectionalShortestPath(BasicGraph<W>& graph, int sourceIndex, int targetIndex, BasicShortestPath<D>& path)
 {
-    // TODO: implement
+    std::unique_ptr<BasicCsrGraph<W>> storage;
+    return BasicShortestPathQuery<W, D>(asCsr(graph, storage))
+        .bidirectionalShortestPath(sourceIndex, targetIndex, path);
+}
+
+// Punkty orientacyjne dla aStarShortestPath tego obiektu (jak computeLandmarks), zapamietane w obiekcie.
+// Złożoność czasowa: O(k * (E + V log V)), pamięciowa: O(k * V)
+template <typename W, typename D>
+void BasicShortestPathQuery<W, D>::computeLandmarks(int count)
+{
+    selectLandmarks(csr, count, landmarkSet);
+}
+
+// A* z heurystyka ALT wzgledem punktow z computeLandmarks (bez nich - zwykly Dijkstra do celu).
+// Złożoność czasowa: O(k * E' + E' log_d V'), zwykle dla duzo mniejszych V', E' niz Dijkstra, pamięciowa: O(V')
+template <typename W, typename D>
+bool BasicShortestPathQuery<W, D>::aStarShortestPath(int sourceIndex, int targetIndex, BasicShortestPath<D>& path)
+{
+    int source = csr.indexOf(sourceIndex);
+    int target = csr.indexOf(targetIndex);
+    reset();
+
+    TrackingQueue<Heap> queue(queues[0], touched[0]);
+    path = {};
+    path.settledVertices = runAStar(csr, landmarkSet, source, target, queue, distance[0], link[0]);
+    return extractPath(csr, target, distance[0], link[0], path);
+}
+
+// Złożoność czasowa: O(k * (E + V log V)) (+ O(V + E log E) dla grafu spoza CSR), pamięciowa: O(k * V)
+template <typename W, typename D>
+void computeLandmarks(BasicGraph<W>& graph, int count, BasicLandmarks<D>& landmarks)
+{
+    std::unique_ptr<BasicCsrGraph<W>> storage;
+    selectLandmarks(asCsr(graph, storage), count, landmarks);
+}
+
+// Pojedyncze zapytanie A*: tablice sa alokowane dla tego jednego wywolania, a graf spoza CSR jest kopiowany do
+// CSR; dla wielu zapytan na jednym grafie sluzy BasicShortestPathQuery z computeLandmarks.
+// Złożoność czasowa: O(V) + zapytania (O(V + E log E) dla grafu spoza CSR), pamięciowa: O(V)
+template <typename W, typename D>
+bool aStarShortestPath(BasicGraph<W>& graph, const BasicLandmarks<D>& landmarks, int sourceIndex, int targetIndex,
+                       BasicShortestPath<D>& path)
+{
+    std::unique_ptr<BasicCsrGraph<W>> storage;
+    const BasicCsrGraph<W>& csr = asCsr(graph, storage);
+
+    int n = csr.numVertices();
+    int source = csr.indexOf(sourceIndex);
+    int target = csr.indexOf(targetIndex);
+    std::vector<D> distance(n, infiniteDistance<D>());
+    std::vector<int> predecessor(n, -1);
+    IndexedHeap<D, GRAPHS_DIJKSTRA_HEAP_ARITY> queue(n);
+    path = {};
+    path.settledVertices = runAStar(csr, landmarks, source, target, queue, distance, predecessor);
+    return extractPath(csr, target, distance, predecessor, path);
+}
+
+// Algorytm Bellmana-Forda na reprezentacji CSR albo bezposrednio na grafie tylko do odczytu.
+// Relaksuje wszystkie krawedzie co najwyzej V-1 razy (konczy wczesniej, gdy nic sie nie zmienia),
+// a nastepnie sprawdza, czy istnieje cykl o ujemnej wadze osiagalny ze zrodla.
+// Zwraca false, jesli taki cykl istnieje.
+// Złożoność czasowa: O(V * E), pamięciowa: O(V)
+template <typename W, typename D>
+bool bellmanFord(BasicGraph<W>& graph, int sourceIndex, BasicShortestPathTree<D>& tree)
+{
+    return withNeighbors(graph, [&](const auto& neighbors) {
+        constexpr D INF = infiniteDistance<D>();
+        int n = neighbors.numVertices();
+        std::vector<D> distance(n, INF);
+        std::vector<int> predecessor(n, -1);
+        int source = neighbors.indexOf(sourceIndex);
+        distance[source] = 0;
+
+        // W grafie nieskierowanym krawedz jest zapisana raz, wiec relaksowana jest tez "pod prad" (zakres in)
+        auto relaxAll = [&]() {
+            bool changed = false;
+            for(int u = 0; u < n; ++u)
+            {
+                if(distance[u] == INF)
+                    continue;
+
+                auto relax = [&](int v, W weight) {
+                    D candidate = distance[u] + static_cast<D>(weight);
+                    if(candidate < distance[v])
+                    {
+                        distance[v] = candidate;
+                        predecessor[v] = u;
+                        changed = true;
+                    }
+                };
+                neighbors.forEachOut(u, relax);
+                if(!neighbors.isDirected())
+                    neighbors.forEachIn(u, relax);
+            }
+            return changed;
+        };
+
+        bool changed = true;
+        for(int i = 1; i < n && changed; ++i)
+        {
+            changed = relaxAll();
+        }
+        if(changed && relaxAll())
+        {
+            return false;
+        }
+
+        tree = makeTree(neighbors, source, distance, predecessor);
+        return true;
+    });
+}
+
+// Złożoność czasowa: O(V * E), pamięciowa: O(V * glebokosc drzewa)
+template <typename W, typename D>
+bool bellmanFord(BasicGraph<W>& graph, int sourceIndex, BasicShortestPathResult<D>& result)
+{
+    BasicShortestPathTree<D> tree;
+    if(!bellmanFord(graph, sourceIndex, tree))
+        return false;
+    result = tree.toMap();
     return true;
 }
+
+#define GRAPHS_INSTANTIATE_SHORTEST_PATHS(W, D)                                                                        \
+    template void dijkstra(BasicGraph<W>&, int, BasicShortestPathTree<D>&, DijkstraQueue);                             \
+    template void dijkstra(BasicGraph<W>&, int, BasicShortestPathResult<D>&, DijkstraQueue);                           \
+    template bool bellmanFord(BasicGraph<W>&, int, BasicShortestPathTree<D>&);                                         \
+    template bool bellmanFord(BasicGraph<W>&, int, BasicShortestPathResult<D>&);                                      \
+    template bool shortestPath(BasicGraph<W>&, int, int, BasicShortestPath<D>&);                                      \
+    template bool bidirectionalShortestPath(BasicGraph<W>&, int, int, BasicShortestPath<D>&);                         \
+    template void computeLandmarks(BasicGraph<W>&, int, BasicLandmarks<D>&);                                         \
+    template bool aStarShortestPath(BasicGraph<W>&, const BasicLandmarks<D>&, int, int, BasicShortestPath<D>&);     \
+    template class BasicShortestPathQuery<W, D>;
+GRAPHS_FOR_EACH_WEIGHT_AND_DISTANCE(GRAPHS_INSTANTIATE_SHORTEST_PATHS)
@@ -0,0 +1,98 @@
+#include "graphs/shortest_path_tree.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+// Złożoność czasowa: O(V), pamięciowa: O(V)
+template <typename D>
+BasicShortestPathTree<D>::BasicShortestPathTree(std::vector<int> ids, int source, std::vector<D> distanceValues,
+                                                std::vector<int> predecessorIndices)
+    : vertexIds(std::move(ids)), distances(std::move(distanceValues)), predecessors(std::move(predecessorIndices)),
+      sourceIndex(source)
+{
+    int n = numVertices();
+    for(int i = 0; i < n; ++i)
+    {
+        if(vertexIds[i] != i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                vertexIndices[vertexIds[j]] = j;
+            }
+            break;
+        }
+    }
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename D>
+int BasicShortestPathTree<D>::indexOf(int v) const
+{
+    if(vertexIndices.empty())
+    {
+        if(v < 0 || v >= numVertices())
+        {
+            throw std::runtime_error("Vertex does not exist");
+        }
+        return v;
+    }
+
+    auto it = vertexIndices.find(v);
+    if(it == vertexIndices.end())
+    {
+        throw std::runtime_error("Vertex does not exist");
+    }
+    return it->second;
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename D>
+bool BasicShortestPathTree<D>::predecessor(int v, int& result) const
+{
+    int u = predecessors[indexOf(v)];
+    if(u == -1)
+        return false;
+    result = vertexIds[u];
+    return true;
+}
+
+// Złożoność czasowa: O(dlugosc sciezki), pamięciowa: O(dlugosc sciezki)
+template <typename D>
+std::vector<int> BasicShortestPathTree<D>::pathTo(int v) const
+{
+    std::vector<int> path;
+    int index = indexOf(v);
+    if(distances[index] == infiniteDistance<D>())
+        return path;
+
+    for(int u = index; u != -1; u = predecessors[u])
+    {
+        path.push_back(vertexIds[u]);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+// Złożoność czasowa: O(V), pamięciowa: O(1)
+template <typename D>
+std::size_t BasicShortestPathTree<D>::reachableCount() const
+{
+    return static_cast<std::size_t>(std::count_if(distances.begin(), distances.end(),
+                                                  [](D distance) { return distance != infiniteDistance<D>(); }));
+}
+
+// Złożoność czasowa: O(V * glebokosc drzewa), pamięciowa: O(V * glebokosc drzewa)
+template <typename D>
+std::map<int, std::pair<D, std::vector<int>>> BasicShortestPathTree<D>::toMap() const
+{
+    std::map<int, std::pair<D, std::vector<int>>> result;
+    for(int v = 0; v < numVertices(); ++v)
+    {
+        if(distances[v] == infiniteDistance<D>())
+            continue;
+        result.emplace_hint(result.end(), vertexIds[v], std::make_pair(distances[v], pathTo(vertexIds[v])));
+    }
+    return result;
+}
+
+#define GRAPHS_INSTANTIATE_SHORTEST_PATH_TREE(D) template class BasicShortestPathTree<D>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_SHORTEST_PATH_TREE)
@@ -6,47 +6,28 @@
 
 #include "graphs/adjacency_list_graph.hpp"
 #include "graphs/adjacency_matrix_graph.hpp"
+#include "graphs/compressed_graph.hpp"
+#include "graphs/csr_binary.hpp"
+#include "graphs/csr_graph.hpp"
+#include "graphs/graph_cache.hpp"
+#include "graphs/graph_formats.hpp"
+#include "graphs/prefetch_loader.hpp"
+#include "graphs/result_io.hpp"
 #include "graphs/shortest_path_algorithms.hpp"
+#include "graphs/succinct_graph.hpp"
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <unordered_map>
 
 using namespace std::string_literals;
 
 const std::filesystem::path dataDirectoryPath{DATA_DIR_PATH};
 
-void readShortestPathResult(std::istream& is, ShortestPathResult& result)
-{
-    result.clear();
-
-    while(is)
-    {
-        std::string line;
-        std::getline(is, line);
-        std::istringstream iss{line};
-
-        int endVertexIndex, cost;
-        iss >> endVertexIndex >> cost;
-
-        if(is)
-        {
-            std::vector<int> vertices;
-            while(iss)
-            {
-                int vertexIndex;
-                iss >> vertexIndex;
-
-                if(iss)
-                {
-                    vertices.push_back(vertexIndex);
-                }
-            }
-
-            result[endVertexIndex] = std::make_pair(cost, vertices);
-        }
-    }
-}
-
-void checkShortestPathResult(const ShortestPathResult& result, const ShortestPathResult& refResult)
+template <typename D>
+void checkShortestPathResult(const BasicShortestPathResult<D>& result, const BasicShortestPathResult<D>& refResult)
 {
     REQUIRE(refResult.size() == result.size());
     for(auto& [refVertexIndex, refValue] : refResult)
@@ -81,14 +62,13 @@ TEST_CASE("Adjacency Matrix Graph -- Dijkstra")
                                          std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
                                                          dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
 
-    std::ifstream inputStream{inputFile}, refStream{refFile};
-    auto graph = AdjacencyMatrixGraph::createGraph(inputStream);
+    std::ifstream refStream{refFile};
+    auto graph = loadCachedGraph<AdjacencyMatrixGraph>(inputFile);
 
     ShortestPathResult result, refResult;
     readShortestPathResult(refStream, refResult);
 
-    int sourceIndex;
-    inputStream >> sourceIndex;
+    int sourceIndex = *loadCachedEdgeList<int>(inputFile)->source;
 
     dijkstra(*graph, sourceIndex, result);
 
@@ -104,20 +84,272 @@ TEST_CASE("Adjacency List Graph -- Dijktra")
                                          std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
                                                          dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
 
-    std::ifstream inputStream{inputFile}, refStream{refFile};
-    auto graph = AdjacencyListGraph::createGraph(inputStream);
+    std::ifstream refStream{refFile};
+    auto graph = loadCachedGraph<AdjacencyListGraph>(inputFile);
 
     ShortestPathResult result, refResult;
     readShortestPathResult(refStream, refResult);
 
-    int sourceIndex;
-    inputStream >> sourceIndex;
+    int sourceIndex = *loadCachedEdgeList<int>(inputFile)->source;
 
     dijkstra(*graph, sourceIndex, result);
 
     checkShortestPathResult(result, refResult);
 }
 
+// Zbiory, w ktorych wszystkie wagi mieszcza sie w uint8_t (najwieksze to 134, 192 i 155); odleglosci w int64_t
+TEMPLATE_TEST_CASE("Narrow weights -- Dijkstra with uint8 weights and int64 distances", "",
+                   BasicAdjacencyMatrixGraph<std::uint8_t>, BasicAdjacencyListGraph<std::uint8_t>)
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.5.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV10D0.5.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.75.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV10D0.75.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV15D0.25.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV15D0.25.txt"));
+
+    std::ifstream inputStream{inputFile};
+    auto graph = TestType::createGraph(inputStream);
+    std::ifstream refStream{refFile};
+    BasicShortestPathResult<std::int64_t> result, refResult;
+    readShortestPathResult(refStream, refResult);
+
+    dijkstra<std::uint8_t, std::int64_t>(*graph, *loadCachedEdgeList<int>(inputFile)->source, result);
+    checkShortestPathResult(result, refResult);
+
+    // Waga spoza zakresu uint8_t nie jest obcinana po cichu
+    std::istringstream outOfRange{"300"}, maximum{"255"}, negative{"-1"};
+    readWeight<std::uint8_t>(outOfRange);
+    REQUIRE(outOfRange.fail());
+    REQUIRE(readWeight<std::uint8_t>(maximum) == 255);
+    REQUIRE_FALSE(maximum.fail());
+    readWeight<std::uint8_t>(negative);
+    REQUIRE(negative.fail());
+    std::istringstream overflowingGraph{"2 1\n0 1 300\n"};
+    REQUIRE_THROWS_AS(TestType::createGraph(overflowingGraph), std::invalid_argument);
+}
+
+TEST_CASE("CSR Graph -- Dijkstra")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D1.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D1.txt"));
+
+    auto edgeList = loadCachedEdgeList<int>(inputFile);
+    std::ifstream refStream{refFile};
+    ShortestPathResult result, refResult;
+    readShortestPathResult(refStream, refResult);
+
+    // Wagi 1..100: Automatic wybiera kolejke Diala, pozostale kolejki musza dac te same odleglosci
+    auto graph = CsrGraph::createGraph(*edgeList);
+    dijkstra(*graph, *edgeList->source, result);
+    checkShortestPathResult(result, refResult);
+    for(auto queue : {DijkstraQueue::DaryHeap, DijkstraQueue::BucketQueue, DijkstraQueue::RadixHeap})
+    {
+        ShortestPathResult queueResult;
+        dijkstra(*graph, *edgeList->source, queueResult, queue);
+        REQUIRE(queueResult.size() == refResult.size());
+        for(auto& [v, value] : refResult)
+        {
+            REQUIRE(queueResult[v].first == value.first);
+        }
+    }
+
+    // Graf nieskierowany: krawedzie relaksowane z obu koncow, jak w Bellmanie-Fordzie
+    auto undirected = CsrGraph::createGraph(*edgeList, EdgeDirection::Undirected);
+    ShortestPathResult undirectedResult, undirectedRef;
+    dijkstra(*undirected, *edgeList->source, undirectedResult);
+    REQUIRE(bellmanFord(*undirected, *edgeList->source, undirectedRef));
+    REQUIRE(undirectedResult.size() == undirectedRef.size());
+    for(auto& [v, value] : undirectedRef)
+    {
+        REQUIRE(undirectedResult[v].first == value.first);
+    }
+}
+
+TEST_CASE("Point-to-point queries -- Dijkstra")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.25.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.25.txt"));
+
+    auto edgeList = loadCachedEdgeList<int>(inputFile);
+    auto graph = CsrGraph::createGraph(*edgeList);
+    std::ifstream refStream{refFile};
+    ShortestPathResult refResult;
+    readShortestPathResult(refStream, refResult);
+
+    // Koszt sciezki liczony po najlzejszych krawedziach miedzy kolejnymi wierzcholkami
+    auto pathCost = [&graph](const std::vector<int>& vertices) {
+        int cost = 0;
+        for(std::size_t i = 1; i < vertices.size(); ++i)
+        {
+            int lightest = std::numeric_limits<int>::max();
+            graph->forEachOutNeighbor(vertices[i - 1], [&](int u, int, int w) {
+                if(u == vertices[i])
+                    lightest = std::min(lightest, w);
+            });
+            REQUIRE(lightest != std::numeric_limits<int>::max());
+            cost += lightest;
+        }
+        return cost;
+    };
+
+    // Obiekt zapytan uzywany ponownie po kazdym zapytaniu musi dawac dokladnie to samo co nowe tablice
+    ShortestPathQuery query(static_cast<const CsrGraph&>(*graph));
+
+    int source = *edgeList->source;
+    int settled = 0, bidirectionalSettled = 0;
+    for(int target = 0; target < edgeList->vertexCount; ++target)
+    {
+        ShortestPath path, bidirectionalPath, queryPath, queryBidirectionalPath;
+        bool found = shortestPath(*graph, source, target, path);
+        REQUIRE(bidirectionalShortestPath(*graph, source, target, bidirectionalPath) == found);
+        REQUIRE(query.bidirectionalShortestPath(source, target, queryBidirectionalPath) == found);
+        REQUIRE(query.shortestPath(source, target, queryPath) == found);
+        REQUIRE(queryPath.vertices == path.vertices);
+        REQUIRE(queryPath.settledVertices == path.settledVertices);
+        REQUIRE(queryBidirectionalPath.vertices == bidirectionalPath.vertices);
+        REQUIRE(queryBidirectionalPath.settledVertices == bidirectionalPath.settledVertices);
+        REQUIRE(found == (refResult.count(target) == 1));
+        if(!found)
+            continue;
+
+        for(const ShortestPath* p : {&path, &bidirectionalPath})
+        {
+            REQUIRE(p->distance == refResult[target].first);
+            REQUIRE(p->vertices.front() == source);
+            REQUIRE(p->vertices.back() == target);
+            REQUIRE(pathCost(p->vertices) == p->distance);
+        }
+        settled += path.settledVertices;
+        bidirectionalSettled += bidirectionalPath.settledVertices;
+    }
+    REQUIRE(bidirectionalSettled < settled);
+}
+
+TEST_CASE("Point-to-point queries -- A* with landmarks")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.25.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.25.txt"));
+
+    auto edgeList = loadCachedEdgeList<int>(inputFile);
+    auto graph = CsrGraph::createGraph(*edgeList);
+    std::ifstream refStream{refFile};
+    ShortestPathResult refResult;
+    readShortestPathResult(refStream, refResult);
+
+    Landmarks landmarks;
+    computeLandmarks(*graph, 4, landmarks);
+    REQUIRE(landmarks.vertices.size() == 4);
+
+    int source = *edgeList->source;
+    int settled = 0, aStarSettled = 0;
+    for(int target = 0; target < edgeList->vertexCount; ++target)
+    {
+        ShortestPath path, aStarPath;
+        bool found = shortestPath(*graph, source, target, path);
+        REQUIRE(aStarShortestPath(*graph, landmarks, source, target, aStarPath) == found);
+        REQUIRE(found == (refResult.count(target) == 1));
+        if(!found)
+            continue;
+
+        REQUIRE(aStarPath.distance == refResult[target].first);
+        REQUIRE(aStarPath.vertices.front() == source);
+        REQUIRE(aStarPath.vertices.back() == target);
+        settled += path.settledVertices;
+        aStarSettled += aStarPath.settledVertices;
+    }
+    REQUIRE(aStarSettled < settled);
+}
+
+TEST_CASE("Point-to-point queries -- A* on undirected graph with isolated vertices")
+{
+    // Wierzcholki izolowane na koncu: sa nieskonczenie daleko od kazdego punktu, ale nie moga zabrac punktow
+    auto cachedEdgeList = loadCachedEdgeList<int>(dataDirectoryPath / "graph" / "graphV200D0.25.txt");
+    EdgeList edgeList = *cachedEdgeList;
+    int connected = edgeList.vertexCount;
+    edgeList.vertexCount += 8;
+    auto graph = CsrGraph::createGraph(edgeList, EdgeDirection::Undirected);
+    const auto& csr = static_cast<const CsrGraph&>(*graph);
+
+    ShortestPathTree tree;
+    dijkstra(*graph, *edgeList.source, tree);
+
+    ShortestPathQuery query(csr);
+    query.computeLandmarks(4);
+    REQUIRE(query.landmarks().vertices.size() == 4);
+    for(int landmark : query.landmarks().vertices)
+    {
+        REQUIRE(landmark < connected);
+    }
+    Landmarks landmarks;
+    computeLandmarks(*graph, 4, landmarks);
+    REQUIRE(landmarks.vertices == query.landmarks().vertices);
+
+    int source = *edgeList.source;
+    int settled = 0, aStarSettled = 0;
+    for(int target = 0; target < edgeList.vertexCount; ++target)
+    {
+        ShortestPath path, aStarPath, queryPath;
+        bool found = query.shortestPath(source, target, path);
+        REQUIRE(query.aStarShortestPath(source, target, queryPath) == found);
+        REQUIRE(aStarShortestPath(*graph, landmarks, source, target, aStarPath) == found);
+        REQUIRE(found == tree.reachable(target));
+        REQUIRE(found == (target < connected));
+        if(!found)
+            continue;
+
+        REQUIRE(queryPath.distance == tree.distanceTo(target));
+        REQUIRE(aStarPath.distance == tree.distanceTo(target));
+        REQUIRE(queryPath.vertices.front() == source);
+        REQUIRE(queryPath.vertices.back() == target);
+        REQUIRE(queryPath.settledVertices == aStarPath.settledVertices);
+        settled += path.settledVertices;
+        aStarSettled += queryPath.settledVertices;
+    }
+    REQUIRE(aStarSettled * 2 < settled);
+}
+
+TEST_CASE("Shortest path tree -- paths on demand")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
+
+    auto graph = loadCachedGraph<AdjacencyListGraph>(inputFile);
+    int source = *loadCachedEdgeList<int>(inputFile)->source;
+    std::ifstream refStream{refFile};
+    ShortestPathResult refResult;
+    readShortestPathResult(refStream, refResult);
+
+    ShortestPathTree tree;
+    REQUIRE(bellmanFord(*graph, source, tree));
+    REQUIRE(tree.source() == source);
+    REQUIRE(tree.reachableCount() == refResult.size());
+    for(auto& [v, refValue] : refResult)
+    {
+        REQUIRE(tree.distanceTo(v) == refValue.first);
+        REQUIRE(tree.pathTo(v) == refValue.second);
+    }
+    checkShortestPathResult(tree.toMap(), refResult);
+
+    // Wierzcholek bez krawedzi wchodzacych jest nieosiagalny
+    int isolated = graph->insertVertex();
+    REQUIRE(bellmanFord(*graph, source, tree));
+    REQUIRE_FALSE(tree.reachable(isolated));
+    REQUIRE(tree.pathTo(isolated).empty());
+    int predecessor;
+    REQUIRE_FALSE(tree.predecessor(isolated, predecessor));
+    REQUIRE_FALSE(tree.predecessor(source, predecessor));
+    REQUIRE_THROWS_AS(tree.distanceTo(isolated + 1), std::runtime_error);
+}
+
 TEST_CASE("Adjacency Matrix Graph -- Bellman-Ford")
 {
     auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.5Negative.txt",
@@ -127,14 +359,13 @@ TEST_CASE("Adjacency Matrix Graph -- Bellman-Ford")
                                          std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
                                                          dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
 
-    std::ifstream inputStream{inputFile}, refStream{refFile};
-    auto graph = AdjacencyMatrixGraph::createGraph(inputStream);
+    std::ifstream refStream{refFile};
+    auto graph = loadCachedGraph<AdjacencyMatrixGraph>(inputFile);
 
     ShortestPathResult result, refResult;
     readShortestPathResult(refStream, refResult);
 
-    int sourceIndex;
-    inputStream >> sourceIndex;
+    int sourceIndex = *loadCachedEdgeList<int>(inputFile)->source;
 
     REQUIRE(bellmanFord(*graph, sourceIndex, result));
 
@@ -142,6 +373,28 @@ TEST_CASE("Adjacency Matrix Graph -- Bellman-Ford")
 }
 
 TEST_CASE("Adjacency List Graph -- Bellman-Ford")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.5Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV10D0.5Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
+
+    std::ifstream refStream{refFile};
+    auto graph = loadCachedGraph<AdjacencyListGraph>(inputFile);
+
+    ShortestPathResult result, refResult;
+    readShortestPathResult(refStream, refResult);
+
+    int sourceIndex = *loadCachedEdgeList<int>(inputFile)->source;
+
+    REQUIRE(bellmanFord(*graph, sourceIndex, result));
+
+    checkShortestPathResult(result, refResult);
+}
+
+TEST_CASE("CSR Graph -- Bellman-Ford")
 {
     auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.5Negative.txt",
                                                          dataDirectoryPath / "sp_result" / "spV10D0.5Negative.txt"),
@@ -151,7 +404,7 @@ TEST_CASE("Adjacency List Graph -- Bellman-Ford")
                                                          dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
 
     std::ifstream inputStream{inputFile}, refStream{refFile};
-    auto graph = AdjacencyListGraph::createGraph(inputStream);
+    auto graph = CsrGraph::createGraph(inputStream);
 
     ShortestPathResult result, refResult;
     readShortestPathResult(refStream, refResult);
@@ -163,3 +416,887 @@ TEST_CASE("Adjacency List Graph -- Bellman-Ford")
 
     checkShortestPathResult(result, refResult);
 }
+
+TEST_CASE("Mapped Edge List -- Bellman-Ford")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.5Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV10D0.5Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
+
+    std::ifstream refStream{refFile};
+    EdgeList edgeList = loadEdgeList<int>(inputFile);
+    REQUIRE(edgeList.source.has_value());
+
+    ShortestPathResult refResult;
+    readShortestPathResult(refStream, refResult);
+
+    for(auto& graph : {AdjacencyListGraph::createGraph(edgeList), AdjacencyMatrixGraph::createGraph(edgeList),
+                       CsrGraph::createGraph(edgeList)})
+    {
+        ShortestPathResult result;
+        REQUIRE(bellmanFord(*graph, *edgeList.source, result));
+        checkShortestPathResult(result, refResult);
+    }
+}
+
+TEST_CASE("Mapped Edge List -- parse errors")
+{
+    std::string input = "3 2\n0 1 5\n1 7 2\n0\n";
+    try
+    {
+        parseEdgeList<int>(input.data(), input.data() + input.size());
+        FAIL("Expected ParseError");
+    }
+    catch(const ParseError& error)
+    {
+        REQUIRE(error.line() == 3);
+    }
+}
+
+TEST_CASE("Graph cache -- repeated loads")
+{
+    std::filesystem::path inputFile = dataDirectoryPath / "graph" / "graphV30D0.25Negative.txt";
+    std::filesystem::path copyFile = std::filesystem::temp_directory_path() / "graphCacheV30D0.25Negative.txt";
+    std::filesystem::copy_file(inputFile, copyFile, std::filesystem::copy_options::overwrite_existing);
+
+    GraphCache cache;
+    auto first = cache.edgeList(copyFile);
+    auto second = cache.edgeList(copyFile);
+    REQUIRE(first == second);
+    REQUIRE(cache.misses() == 1);
+    REQUIRE(cache.hits() == 1);
+
+    // Zmiana rozmiaru pliku wymusza ponowne parsowanie
+    std::ofstream(copyFile, std::ios::app) << "\n";
+    auto changed = cache.edgeList(copyFile);
+    REQUIRE(changed != first);
+    REQUIRE(changed->edges.size() == first->edges.size());
+    REQUIRE(cache.misses() == 2);
+
+    // Obie reprezentacje z tej samej, juz wczytanej listy krawedzi
+    ShortestPathResult listResult, matrixResult;
+    REQUIRE(bellmanFord(*cache.load<AdjacencyListGraph>(copyFile), *changed->source, listResult));
+    REQUIRE(bellmanFord(*cache.load<AdjacencyMatrixGraph>(copyFile), *changed->source, matrixResult));
+    REQUIRE(listResult == matrixResult);
+    REQUIRE(cache.misses() == 2);
+    REQUIRE(cache.size() == 1);
+
+    std::filesystem::remove(copyFile);
+}
+
+TEST_CASE("Prefetch loader -- dataset directory")
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "piaa_prefetch_test";
+    std::filesystem::create_directories(directory);
+    std::filesystem::copy_file(dataDirectoryPath / "graph" / "graphV10D0.5Negative.txt", directory / "a.txt",
+                               std::filesystem::copy_options::overwrite_existing);
+    std::ofstream(directory / "b.txt") << "3 1\n0 7 1\n";
+    std::filesystem::copy_file(dataDirectoryPath / "graph" / "graphV30D0.25Negative.txt", directory / "c.txt",
+                               std::filesystem::copy_options::overwrite_existing);
+    std::ofstream(directory / "notes.md") << "pomijany\n";
+
+    {
+        PrefetchLoader loader{directory, ".txt", 1};
+        REQUIRE(loader.paths().size() == 3);
+
+        PrefetchLoader::Item item;
+        REQUIRE(loader.next(item));
+        REQUIRE(item.path.filename() == "a.txt");
+        REQUIRE(item.edgeList.vertexCount == 10);
+
+        // Blad parsowania dotyczy tylko swojego pliku
+        REQUIRE_THROWS_AS(loader.next(item), ParseError);
+        REQUIRE(loader.next(item));
+        REQUIRE(item.path.filename() == "c.txt");
+        REQUIRE(item.edgeList.edges.size() == loadEdgeList<int>(item.path).edges.size());
+        REQUIRE_FALSE(loader.next(item));
+    }
+
+    // Zniszczenie przy pelnej kolejce przerywa wczytywanie
+    {
+        PrefetchLoader loader{directory, ".txt", 1};
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Binary CSR file -- Bellman-Ford")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.5Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV10D0.5Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
+
+    std::filesystem::path binaryFile = std::filesystem::temp_directory_path() / inputFile.filename();
+    binaryFile.replace_extension(".csr");
+    convertTextToCsrBinary<int>(inputFile, binaryFile);
+
+    std::ifstream refStream{refFile};
+    ShortestPathResult result, refResult;
+    readShortestPathResult(refStream, refResult);
+
+    auto graph = loadCsrBinary<int>(binaryFile);
+    REQUIRE(bellmanFord(*graph, *loadCachedEdgeList<int>(inputFile)->source, result));
+    checkShortestPathResult(result, refResult);
+
+    REQUIRE_THROWS_AS(loadCsrBinary<double>(binaryFile), std::runtime_error);
+    std::filesystem::remove(binaryFile);
+
+    // Indeks wierzcholka spoza grafu w tablicach (jak w uszkodzonym pliku) jest odrzucany
+    auto arrays = graph->arrays();
+    std::vector<int> targets(arrays.outTargets.begin(), arrays.outTargets.end());
+    targets.back() = graph->numVertices();
+    arrays.outTargets = targets;
+    REQUIRE_THROWS_AS(CsrGraph::fromArrays(arrays, nullptr, true), std::invalid_argument);
+}
+
+TEST_CASE("Parallel Edge List -- Bellman-Ford")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D1.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D1.txt"));
+
+    EdgeList edgeList = loadEdgeListParallel<int>(inputFile, 4);
+    EdgeList refEdgeList = loadEdgeList<int>(inputFile);
+    REQUIRE(edgeList.vertexCount == refEdgeList.vertexCount);
+    REQUIRE(edgeList.source == refEdgeList.source);
+    REQUIRE(std::equal(edgeList.edges.begin(), edgeList.edges.end(), refEdgeList.edges.begin(),
+                       refEdgeList.edges.end(), [](const Graph::EdgeInput& a, const Graph::EdgeInput& b) {
+                           return a.v1 == b.v1 && a.v2 == b.v2 && a.weight == b.weight;
+                       }));
+
+    std::ifstream refStream{refFile};
+    ShortestPathResult result, refResult;
+    readShortestPathResult(refStream, refResult);
+
+    auto graph = CsrGraph::createGraph(edgeList, EdgeDirection::Directed, 4);
+    REQUIRE(bellmanFord(*graph, *edgeList.source, result));
+    checkShortestPathResult(result, refResult);
+}
+
+TEST_CASE("Parallel Edge List -- large input and chunk boundaries")
+{
+    // 300K krawedzi: ponad 64 KB tekstu i 64K krawedzi na watek, wiec parser i budowa CSR uzywaja 4 watkow
+    const int vertexCount = 5000, edgeCount = 300000;
+    std::string input = std::to_string(vertexCount) + " " + std::to_string(edgeCount) + "\n";
+    for(int e = 0; e < edgeCount; ++e)
+    {
+        input += std::to_string(e * 7919LL % vertexCount) + " " + std::to_string(e * 104729LL % vertexCount) + " " +
+                 std::to_string(10 + e % 90) + "\n";
+    }
+    input += "0\n";
+
+    EdgeList edgeList = parseEdgeListParallel<int>(input.data(), input.data() + input.size(), 4);
+    EdgeList refEdgeList = parseEdgeList<int>(input.data(), input.data() + input.size());
+    REQUIRE(edgeList.source == refEdgeList.source);
+    REQUIRE(std::equal(edgeList.edges.begin(), edgeList.edges.end(), refEdgeList.edges.begin(),
+                       refEdgeList.edges.end(), [](const Graph::EdgeInput& a, const Graph::EdgeInput& b) {
+                           return a.v1 == b.v1 && a.v2 == b.v2 && a.weight == b.weight;
+                       }));
+
+    auto graph = CsrGraph::createGraph(edgeList, EdgeDirection::Directed, 4);
+    auto refGraph = CsrGraph::createGraph(refEdgeList, EdgeDirection::Directed, 1);
+    auto arrays = dynamic_cast<const CsrGraph&>(*graph).arrays();
+    auto refArrays = dynamic_cast<const CsrGraph&>(*refGraph).arrays();
+    auto same = [](Span<const int> a, Span<const int> b) { return std::equal(a.begin(), a.end(), b.begin(), b.end()); };
+    REQUIRE(same(arrays.outOffsets, refArrays.outOffsets));
+    REQUIRE(same(arrays.outTargets, refArrays.outTargets));
+    REQUIRE(same(arrays.outWeights, refArrays.outWeights));
+    REQUIRE(same(arrays.inOffsets, refArrays.inOffsets));
+    REQUIRE(same(arrays.inSlots, refArrays.inSlots));
+    REQUIRE(same(arrays.edgeSlots, refArrays.edgeSlots));
+
+    // Blad w linii tuz przed, na i tuz za granica fragmentu (podzial jak w parseEdgeListParallel) ma ten sam
+    // numer linii co w parserze jednowatkowym
+    std::size_t body = input.find('\n');
+    for(int t = 1; t < 4; ++t)
+    {
+        std::size_t boundary = input.find('\n', body + (input.size() - body) * t / 4) + 1;
+        for(std::size_t lineStart : {input.rfind('\n', boundary - 2) + 1, boundary, input.find('\n', boundary) + 1})
+        {
+            std::string corrupted = input;
+            corrupted[input.find('\n', lineStart) - 1] = 'x';
+            int line = -1, refLine = -2;
+            try
+            {
+                parseEdgeListParallel<int>(corrupted.data(), corrupted.data() + corrupted.size(), 4);
+            }
+            catch(const ParseError& error)
+            {
+                line = error.line();
+            }
+            try
+            {
+                parseEdgeList<int>(corrupted.data(), corrupted.data() + corrupted.size());
+            }
+            catch(const ParseError& error)
+            {
+                refLine = error.line();
+            }
+            REQUIRE(line == refLine);
+            REQUIRE(line == 1 + static_cast<int>(std::count(input.begin(), input.begin() + lineStart, '\n')));
+        }
+    }
+}
+
+TEST_CASE("Graph file importers -- Bellman-Ford")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.5Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV10D0.5Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
+
+    auto cachedEdgeList = loadCachedEdgeList<int>(inputFile);
+    const EdgeList& edgeList = *cachedEdgeList;
+
+    // Ten sam graf w formatach DIMACS, Matrix Market i SNAP
+    std::ostringstream dimacs, matrixMarket, snap;
+    dimacs << "c converted from " << inputFile.filename().string() << "\n"
+           << "p sp " << edgeList.vertexCount << ' ' << edgeList.edges.size() << "\n";
+    matrixMarket << "%%MatrixMarket matrix coordinate integer general\n% comment\n"
+                 << edgeList.vertexCount << ' ' << edgeList.vertexCount << ' ' << edgeList.edges.size() << "\n";
+    snap << "# Nodes: " << edgeList.vertexCount << "\n# FromNodeId\tToNodeId\tWeight\n";
+    for(const auto& edge : edgeList.edges)
+    {
+        dimacs << "a " << edge.v1 + 1 << ' ' << edge.v2 + 1 << ' ' << edge.weight << "\n";
+        matrixMarket << edge.v1 + 1 << ' ' << edge.v2 + 1 << ' ' << edge.weight << "\n";
+        snap << edge.v1 << '\t' << edge.v2 << '\t' << edge.weight << "\n";
+    }
+
+    std::string dimacsText = dimacs.str(), matrixMarketText = matrixMarket.str(), snapText = snap.str();
+    std::vector<int> snapIds; // SNAP numeruje od nowa tylko wierzcholki wystepujace w krawedziach
+    EdgeList imported[] = {parseDimacs<int>(dimacsText.data(), dimacsText.data() + dimacsText.size()),
+                           parseMatrixMarket<int>(matrixMarketText.data(),
+                                                  matrixMarketText.data() + matrixMarketText.size()),
+                           parseSnapEdgeList<int>(snapText.data(), snapText.data() + snapText.size(), &snapIds)};
+    for(auto& edge : imported[2].edges)
+    {
+        edge.v1 = snapIds[edge.v1];
+        edge.v2 = snapIds[edge.v2];
+    }
+
+    std::ifstream refStream{refFile};
+    ShortestPathResult refResult;
+    readShortestPathResult(refStream, refResult);
+
+    for(EdgeList& importedList : imported)
+    {
+        REQUIRE(std::equal(importedList.edges.begin(), importedList.edges.end(), edgeList.edges.begin(),
+                           edgeList.edges.end(), [](const Graph::EdgeInput& a, const Graph::EdgeInput& b) {
+                               return a.v1 == b.v1 && a.v2 == b.v2 && a.weight == b.weight;
+                           }));
+
+        // SNAP nie zapisuje liczby wierzcholkow (izolowane sa pomijane), wiec wyrownujemy ja do wejscia
+        importedList.vertexCount = edgeList.vertexCount;
+        ShortestPathResult result;
+        REQUIRE(bellmanFord(*CsrGraph::createGraph(importedList), *edgeList.source, result));
+        checkShortestPathResult(result, refResult);
+    }
+
+    // Rzadkie identyfikatory SNAP sa zamieniane na kolejne indeksy, bez izolowanych wierzcholkow
+    std::string unweighted = "# directed\n0\t1\n1\t2147483647\t5\n";
+    std::vector<int> sparseIds;
+    EdgeList snapList = parseSnapEdgeList<int>(unweighted.data(), unweighted.data() + unweighted.size(), &sparseIds);
+    REQUIRE(snapList.vertexCount == 3);
+    REQUIRE(sparseIds == std::vector<int>{0, 1, 2147483647});
+    REQUIRE(snapList.edges[1].v2 == 2);
+    REQUIRE(snapList.edges[0].weight == 1);
+    REQUIRE(snapList.edges[1].weight == 5);
+}
+
+TEST_CASE("Graph file importers -- Matrix Market headers and errors")
+{
+    auto parse = [](const std::string& text) { return parseMatrixMarket<int>(text.data(), text.data() + text.size()); };
+    auto edges = [](const EdgeList& list) {
+        std::vector<std::tuple<int, int, int>> result;
+        for(const auto& edge : list.edges)
+        {
+            result.emplace_back(edge.v1, edge.v2, edge.weight);
+        }
+        return result;
+    };
+    using Edges = std::vector<std::tuple<int, int, int>>;
+
+    EdgeList symmetric = parse("%%MatrixMarket matrix coordinate integer symmetric\n3 3 3\n1 1 4\n2 1 5\n3 2 -6\n");
+    REQUIRE(symmetric.vertexCount == 3);
+    REQUIRE(edges(symmetric) == Edges{{0, 0, 4}, {1, 0, 5}, {0, 1, 5}, {2, 1, -6}, {1, 2, -6}});
+
+    EdgeList skew = parse("%%MatrixMarket matrix coordinate real skew-symmetric\n2 2 1\n2 1 7\n");
+    REQUIRE(edges(skew) == Edges{{1, 0, 7}, {0, 1, -7}});
+
+    EdgeList pattern = parse("%%matrixmarket MATRIX Coordinate Pattern General\n% komentarz\n2 3 2\n1 3\n2 1\n");
+    REQUIRE(pattern.vertexCount == 3);
+    REQUIRE(edges(pattern) == Edges{{0, 2, 1}, {1, 0, 1}});
+
+    // Numer linii bledu dla naglowkow i wpisow spoza formatu
+    auto errorLine = [&parse](const std::string& text) {
+        try
+        {
+            parse(text);
+        }
+        catch(const ParseError& error)
+        {
+            return error.line();
+        }
+        return 0;
+    };
+    REQUIRE(errorLine("%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n") == 1);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate complex general\n1 1 1\n1 1 1 0\n") == 1);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate pattern skew-symmetric\n1 1 0\n") == 1);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer general\n2 2 2\n1 2 3\n3 1 4\n") == 4);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer general\n2 2 2\n1 0 3\n2 1 4\n") == 3);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer general\n2 2 2\n1 2 x\n2 1 4\n") == 3);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer general\n2 2 2\n1 2 3 9\n2 1 4\n") == 3);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer general\n2 2 3\n1 2 3\n2 1 4\n") == 5);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer general\n2 2 1\n1 2 3\n2 1 4\n") == 4);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer general\n2 2 1\n1 2 99999999999\n") == 3);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer symmetric\n2 3 1\n2 1 1\n") == 2);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer symmetric\n2 2 1\n1 2 1\n") == 3);
+    REQUIRE(errorLine("%%MatrixMarket matrix coordinate integer skew-symmetric\n2 2 1\n1 1 1\n") == 3);
+}
+
+TEST_CASE("Result files -- text and binary round trip")
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
+
+    auto cachedEdgeList = loadCachedEdgeList<int>(inputFile);
+    const EdgeList& edgeList = *cachedEdgeList;
+    auto graph = CsrGraph::createGraph(edgeList);
+    ShortestPathResult result;
+    REQUIRE(bellmanFord(*graph, *edgeList.source, result));
+
+    std::filesystem::path textFile = std::filesystem::temp_directory_path() / refFile.filename();
+    std::filesystem::path binaryFile = textFile;
+    binaryFile.replace_extension(".spr");
+    saveShortestPathResult(result, textFile);
+    saveShortestPathResultBinary(result, binaryFile);
+
+    REQUIRE(loadShortestPathResult<int>(textFile) == result);
+    REQUIRE(loadShortestPathResultBinary<int>(binaryFile) == result);
+    checkShortestPathResult(loadShortestPathResult<int>(textFile), loadShortestPathResult<int>(refFile));
+    REQUIRE_THROWS_AS(loadShortestPathResultBinary<double>(binaryFile), std::runtime_error);
+
+    MinimumSpanningTreeResult tree{{0, 1, 7}, {1, 2, -3}, {4, 2, 0}};
+    saveMstResultBinary(tree, binaryFile);
+    REQUIRE(loadMstResultBinary<int>(binaryFile) == tree);
+    saveMstResult(tree, textFile);
+    REQUIRE(loadMstResult<int>(textFile) == tree);
+}
+
+TEMPLATE_TEST_CASE("Read-only graphs -- Bellman-Ford", "", CompressedGraph, SuccinctGraph)
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV10D0.5Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV10D0.5Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25Negative.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25Negative.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.25.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.25.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D0.75.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D0.75.txt"));
+
+    auto cachedEdgeList = loadCachedEdgeList<int>(inputFile);
+    const EdgeList& edgeList = *cachedEdgeList;
+    auto graph = TestType::createGraph(edgeList);
+    auto csrGraph = CsrGraph::createGraph(edgeList);
+    auto& readOnly = static_cast<TestType&>(*graph);
+    auto& csr = static_cast<CsrGraph&>(*csrGraph);
+
+    for(int v = 0; v < edgeList.vertexCount; ++v)
+    {
+        // Ci sami sasiedzi co w CSR, nastepniki zdekodowane rosnaco
+        std::vector<std::pair<int, int>> neighbors, refNeighbors;
+        readOnly.forEachOutNeighbor(v, [&neighbors](int u, int, int w) { neighbors.emplace_back(u, w); });
+        csr.forEachOutNeighbor(v, [&refNeighbors](int u, int, int w) { refNeighbors.emplace_back(u, w); });
+        REQUIRE(std::is_sorted(neighbors.begin(), neighbors.end(),
+                               [](auto& a, auto& b) { return a.first < b.first; }));
+        if constexpr(std::is_same_v<TestType, SuccinctGraph>)
+        {
+            for(int k = 0; k < readOnly.outDegree(v); ++k)
+            {
+                REQUIRE(readOnly.neighbor(v, k) == neighbors[k].first);
+            }
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        std::sort(refNeighbors.begin(), refNeighbors.end());
+        REQUIRE(neighbors == refNeighbors);
+
+        std::vector<std::pair<int, int>> inNeighbors, refInNeighbors;
+        readOnly.forEachInNeighbor(v, [&inNeighbors](int u, int, int w) { inNeighbors.emplace_back(u, w); });
+        csr.forEachInNeighbor(v, [&refInNeighbors](int u, int, int w) { refInNeighbors.emplace_back(u, w); });
+        std::sort(inNeighbors.begin(), inNeighbors.end());
+        std::sort(refInNeighbors.begin(), refInNeighbors.end());
+        REQUIRE(inNeighbors == refInNeighbors);
+
+        // Krawedzie incydentne to suma wychodzacych i wchodzacych (petla wlasna raz)
+        std::vector<int> incident = readOnly.incidentEdges(v), expected = readOnly.outEdges(v);
+        for(int e : readOnly.inEdges(v))
+        {
+            REQUIRE(readOnly.endpoints(e).second == v);
+            expected.push_back(e);
+        }
+        std::sort(incident.begin(), incident.end());
+        std::sort(expected.begin(), expected.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+        REQUIRE(incident == expected);
+        REQUIRE(incident.size() == csr.incidentEdges(v).size());
+
+        for(int u = 0; u < edgeList.vertexCount; ++u)
+        {
+            REQUIRE(readOnly.areAdjacent(v, u) == csr.areAdjacent(v, u));
+        }
+    }
+    for(int e = 0; e < readOnly.numEdges(); ++e)
+    {
+        auto [v1, v2] = readOnly.endpoints(e);
+        REQUIRE(readOnly.areAdjacent(v1, v2));
+    }
+    REQUIRE_THROWS_AS(readOnly.insertVertex(), std::logic_error);
+    REQUIRE_THROWS_AS(readOnly.removeEdge(0), std::logic_error);
+
+    // Tablice CSR: 3 tablice wierzcholkow i 6 tablic krawedzi; na malych grafach przewazaja tablice wierzcholkow.
+    // Na rzadkich grafach klucze Eliasa-Fano sa mniejsze niz odstepy w group varint.
+    std::size_t n = csr.numVertices(), m = csr.numEdges();
+    if(m >= 1000)
+    {
+        REQUIRE(readOnly.memoryUsage() * 3 < (3 * n + 2 + 6 * m) * sizeof(int));
+        if constexpr(std::is_same_v<TestType, SuccinctGraph>)
+            REQUIRE(readOnly.memoryUsage() < CompressedGraph::fromGraph(*graph)->memoryUsage());
+    }
+
+    std::ifstream refStream{refFile};
+    ShortestPathResult result, refResult;
+    readShortestPathResult(refStream, refResult);
+    REQUIRE(bellmanFord(*graph, *edgeList.source, result));
+    checkShortestPathResult(result, refResult);
+}
+
+TEST_CASE("Succinct Graph -- in-edges with parallel edges and loops")
+{
+    // Krawedzie wielokrotne z jednego poczatku maja kolejne identyfikatory, ich wagi odrozniaja krawedzie
+    EdgeList edgeList;
+    edgeList.vertexCount = 5;
+    edgeList.edges = {{3, 1, 10}, {0, 1, 11}, {3, 1, 12}, {1, 1, 13}, {4, 0, 14}, {3, 1, 15}, {2, 4, 16}, {0, 1, 17}};
+    auto graph = SuccinctGraph::createGraph(edgeList);
+    auto& succinct = static_cast<SuccinctGraph&>(*graph);
+
+    for(int v = 0; v < edgeList.vertexCount; ++v)
+    {
+        std::vector<std::pair<int, int>> inNeighbors, expected;
+        succinct.forEachInNeighbor(v, [&](int u, int e, int w) {
+            REQUIRE(succinct.endpoints(e) == std::make_pair(u, v));
+            REQUIRE(succinct.edgeWeight(e) == w);
+            inNeighbors.emplace_back(u, w);
+        });
+        for(auto& edge : edgeList.edges)
+        {
+            if(edge.v2 == v)
+                expected.emplace_back(edge.v1, edge.weight);
+        }
+        std::sort(inNeighbors.begin(), inNeighbors.end());
+        std::sort(expected.begin(), expected.end());
+        REQUIRE(inNeighbors == expected);
+        REQUIRE(succinct.inEdges(v).size() == expected.size());
+    }
+    REQUIRE(succinct.incidentEdges(1).size() == 6);
+    REQUIRE(succinct.incidentEdges(3).size() == 3);
+}
+
+TEMPLATE_TEST_CASE("Read-only graphs -- Dijkstra on the cursor", "", CompressedGraph, SuccinctGraph)
+{
+    auto [inputFile, refFile] = GENERATE(std::make_tuple(dataDirectoryPath / "graph" / "graphV30D0.25.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV30D0.25.txt"),
+                                         std::make_tuple(dataDirectoryPath / "graph" / "graphV200D1.txt",
+                                                         dataDirectoryPath / "sp_result" / "spV200D1.txt"));
+
+    auto edgeList = loadCachedEdgeList<int>(inputFile);
+    std::ifstream refStream{refFile};
+    ShortestPathResult refResult;
+    readShortestPathResult(refStream, refResult);
+
+    auto graph = TestType::createGraph(*edgeList);
+    int source = *edgeList->source;
+    for(auto queue : {DijkstraQueue::Automatic, DijkstraQueue::DaryHeap, DijkstraQueue::RadixHeap})
+    {
+        ShortestPathResult result;
+        dijkstra(*graph, source, result, queue);
+        checkShortestPathResult(result, refResult);
+    }
+    for(auto& [v, value] : refResult)
+    {
+        ShortestPath path;
+        REQUIRE(shortestPath(*graph, source, v, path));
+        REQUIRE(path.distance == value.first);
+        REQUIRE(path.vertices.front() == source);
+        REQUIRE(path.vertices.back() == v);
+    }
+
+    // Algorytmy, ktore potrzebuja CSR, odrzucaja graf skompresowany zamiast go po cichu kopiowac
+    Landmarks landmarks;
+    ShortestPath path;
+    REQUIRE_THROWS_AS(computeLandmarks(*graph, 2, landmarks), std::invalid_argument);
+    REQUIRE_THROWS_AS(bidirectionalShortestPath(*graph, source, source, path), std::invalid_argument);
+}
+
+TEMPLATE_TEST_CASE("Adjacency graphs -- stale ids after slot reuse", "", AdjacencyListGraph, AdjacencyMatrixGraph)
+{
+    auto direction = GENERATE(EdgeDirection::Directed, EdgeDirection::Undirected);
+    TestType graph{direction};
+    int a = graph.insertVertex();
+    int b = graph.insertVertex();
+
+    // Slot krawedzi sluzy 16 razy (4 bity generacji), kazdy stary identyfikator jest potem niewazny
+    constexpr int edgeSlotUses = 16;
+    std::vector<int> removed;
+    for(int i = 0; i < edgeSlotUses; ++i)
+    {
+        int e = graph.insertEdge(a, b, i);
+        REQUIRE(std::find(removed.begin(), removed.end(), e) == removed.end());
+        graph.removeEdge(e);
+        removed.push_back(e);
+    }
+    int fresh = graph.insertEdge(a, b, 7);
+    REQUIRE(fresh == 1); // wycofany slot 0 nie jest juz uzywany, krawedz dostaje nowy slot 1
+    for(int e : removed)
+    {
+        REQUIRE_THROWS(graph.removeEdge(e));
+        REQUIRE_THROWS(graph.edgeWeight(e));
+        REQUIRE_THROWS(graph.endpoints(e));
+    }
+    REQUIRE(graph.numEdges() == 1);
+    REQUIRE(graph.showEdges() == std::vector<int>{fresh});
+    REQUIRE(graph.edgeWeight(fresh) == 7);
+
+    // Usuniety wierzcholek: jego slot dostaje nastepny wierzcholek, a stary identyfikator jest odrzucany
+    graph.removeVertex(b);
+    REQUIRE(graph.numEdges() == 0);
+    int c = graph.insertVertex(5);
+    REQUIRE(c != b);
+    REQUIRE_THROWS(graph.removeVertex(b));
+    REQUIRE_THROWS(graph.insertEdge(a, b, 1));
+    REQUIRE_THROWS(graph.outEdges(b));
+    REQUIRE_THROWS(graph.removeEdge(fresh));
+    REQUIRE(graph.numVertices() == 2);
+    REQUIRE(graph.outEdges(c).empty());
+}
+
+TEMPLATE_TEST_CASE("Adjacency graphs -- invalid batch insert", "", AdjacencyListGraph, AdjacencyMatrixGraph)
+{
+    auto direction = GENERATE(EdgeDirection::Directed, EdgeDirection::Undirected);
+    TestType graph{direction};
+    int first = graph.insertVertices(4);
+    std::vector<Graph::EdgeInput> valid{{first, first + 1, 3}, {first + 1, first + 2, 4}};
+    graph.insertEdges(valid);
+    int removed = graph.insertVertex();
+    graph.removeVertex(removed);
+
+    std::vector<int> edgesBefore = graph.showEdges();
+    std::vector<int> outBefore = graph.outEdges(first + 1);
+
+    // Jeden zly koniec (poza zakresem albo usuniety wierzcholek) odrzuca cala porcje przed jakakolwiek zmiana
+    int badEndpoint = GENERATE_COPY(first + 100, -1, removed);
+    std::vector<Graph::EdgeInput> batch{{first, first + 3, 1}, {first + 1, first + 3, 2}, {first + 2, badEndpoint, 5}};
+    REQUIRE_THROWS(graph.insertEdges(batch));
+    std::swap(batch.back().v1, batch.back().v2);
+    REQUIRE_THROWS(graph.insertEdges(batch));
+
+    REQUIRE(graph.numEdges() == 2);
+    REQUIRE(graph.showEdges() == edgesBefore);
+    REQUIRE(graph.outEdges(first + 1) == outBefore);
+    REQUIRE(graph.outEdges(first + 3).empty());
+    REQUIRE(graph.inEdges(first + 3).empty());
+    REQUIRE_FALSE(graph.areAdjacent(first, first + 3));
+
+    REQUIRE_THROWS_AS(graph.insertVertices(-1), std::invalid_argument);
+    REQUIRE(graph.numVertices() == 4);
+
+    // Po odrzuconych porcjach wstawianie hurtowe dziala dalej
+    batch.pop_back();
+    graph.insertEdges(batch);
+    REQUIRE(graph.numEdges() == 4);
+    REQUIRE(graph.areAdjacent(first, first + 3));
+}
+
+// Porownuje outEdges / inEdges / incidentEdges kazdego wierzcholka z wyliczonymi z endpoints wszystkich krawedzi
+void checkIncidenceIndex(const Graph& graph)
+{
+    std::vector<int> edges = graph.showEdges();
+    REQUIRE(static_cast<int>(edges.size()) == graph.numEdges());
+    for(int v : graph.showVertices())
+    {
+        std::vector<int> out, in, incident;
+        for(int e : edges)
+        {
+            auto [v1, v2] = graph.endpoints(e);
+            bool isOut = v1 == v || (!graph.isDirected() && v2 == v);
+            bool isIn = v2 == v || (!graph.isDirected() && v1 == v);
+            if(isOut)
+                out.push_back(e);
+            if(isIn)
+                in.push_back(e);
+            if(isOut || isIn)
+                incident.push_back(e); // petla wlasna tylko raz
+        }
+
+        auto sorted = [](std::vector<int> ids) {
+            std::sort(ids.begin(), ids.end());
+            return ids;
+        };
+        INFO("Checking incidence lists of vertex " << v);
+        REQUIRE(sorted(graph.outEdges(v)) == sorted(out));
+        REQUIRE(sorted(graph.inEdges(v)) == sorted(in));
+        REQUIRE(sorted(graph.incidentEdges(v)) == sorted(incident));
+    }
+}
+
+TEST_CASE("Adjacency List Graph -- incidence lists after removals")
+{
+    auto direction = GENERATE(EdgeDirection::Directed, EdgeDirection::Undirected);
+    AdjacencyListGraph graph{direction};
+    int a = graph.insertVertex();
+    int b = graph.insertVertex();
+    int c = graph.insertVertex();
+    int d = graph.insertVertex();
+
+    int ab = graph.insertEdge(a, b, 1);
+    int parallel = graph.insertEdge(a, b, 2);
+    int loop = graph.insertEdge(a, a, 3);
+    graph.insertEdge(b, c, 4);
+    int ca = graph.insertEdge(c, a, 5);
+    graph.insertEdge(d, b, 6);
+    checkIncidenceIndex(graph);
+    REQUIRE(graph.incidentEdges(a).size() == 4);
+
+    // Usuniecie jednej z krawedzi rownoleglych zostawia druga na listach obu koncow
+    graph.removeEdge(ab);
+    checkIncidenceIndex(graph);
+    REQUIRE(graph.areAdjacent(a, b));
+    if(graph.isDirected())
+        REQUIRE(graph.outEdges(a) == std::vector<int>{parallel, loop});
+    else
+        REQUIRE(graph.outEdges(a) == std::vector<int>{parallel, loop, ca});
+
+    graph.removeEdge(loop);
+    checkIncidenceIndex(graph);
+    REQUIRE_FALSE(graph.areAdjacent(a, a));
+    loop = graph.insertEdge(a, a, 7);
+    checkIncidenceIndex(graph);
+
+    // removeVertex usuwa krawedzie wychodzace, wchodzace i petle z list pozostalych wierzcholkow
+    graph.removeVertex(a);
+    checkIncidenceIndex(graph);
+    REQUIRE(graph.numEdges() == 2);
+    for(int e : {parallel, loop, ca})
+    {
+        REQUIRE_THROWS(graph.endpoints(e));
+    }
+    REQUIRE(graph.incidentEdges(c).size() == 1);
+    REQUIRE_FALSE(graph.areAdjacent(c, a));
+
+    int e = graph.insertVertex();
+    graph.insertEdge(e, e, 8);
+    graph.insertEdge(c, e, 9);
+    checkIncidenceIndex(graph);
+    REQUIRE(graph.incidentEdges(e).size() == 2);
+
+    graph.removeVertex(b);
+    checkIncidenceIndex(graph);
+    REQUIRE(graph.outEdges(d).empty());
+    REQUIRE(graph.numEdges() == 2);
+}
+
+TEST_CASE("Adjacency Matrix Graph -- edge-id matrix after overwrites and slot reuse")
+{
+    auto direction = GENERATE(EdgeDirection::Directed, EdgeDirection::Undirected);
+    AdjacencyMatrixGraph graph{direction};
+    int a = graph.insertVertex();
+    int b = graph.insertVertex();
+    int c = graph.insertVertex();
+
+    int ab = graph.insertEdge(a, b, 1);
+    graph.insertEdge(b, c, 2);
+    int ca = graph.insertEdge(c, a, 3);
+    int loop = graph.insertEdge(a, a, 4);
+    checkIncidenceIndex(graph);
+
+    // Krawedz rownolegla nadpisuje pole: stara krawedz znika, liczba krawedzi sie nie zmienia.
+    // W grafie nieskierowanym to samo pole zajmuje tez krawedz w przeciwna strone.
+    int parallel = graph.isDirected() ? graph.insertEdge(a, b, 9) : graph.insertEdge(b, a, 9);
+    REQUIRE(parallel != ab);
+    REQUIRE(graph.numEdges() == 4);
+    REQUIRE_THROWS(graph.edgeWeight(ab));
+    REQUIRE(graph.edgeWeight(parallel) == 9);
+    std::vector<int> shown = graph.showEdges();
+    REQUIRE(std::find(shown.begin(), shown.end(), ab) == shown.end());
+    REQUIRE(std::find(shown.begin(), shown.end(), parallel) != shown.end());
+    checkIncidenceIndex(graph);
+
+    std::vector<std::pair<int, int>> neighbors;
+    graph.forEachOutNeighbor(a, [&neighbors, loop](int u, int e, int w) {
+        if(e != loop)
+            neighbors.emplace_back(u, w);
+    });
+    if(graph.isDirected())
+        REQUIRE(neighbors == std::vector<std::pair<int, int>>{{b, 9}});
+    else
+        REQUIRE(neighbors == std::vector<std::pair<int, int>>{{b, 9}, {c, 3}});
+
+    // Usuniecie wierzcholka czysci jego wiersz i kolumne; nastepny wierzcholek dostaje ten sam slot
+    graph.removeVertex(b);
+    REQUIRE(graph.numEdges() == 2);
+    REQUIRE_THROWS(graph.edgeWeight(parallel));
+    checkIncidenceIndex(graph);
+
+    int d = graph.insertVertex();
+    REQUIRE(d != b);
+    REQUIRE(graph.outEdges(d).empty());
+    REQUIRE(graph.inEdges(d).empty());
+    REQUIRE(graph.incidentEdges(d).empty());
+    REQUIRE_FALSE(graph.areAdjacent(a, d));
+    REQUIRE_FALSE(graph.areAdjacent(d, c));
+    checkIncidenceIndex(graph);
+
+    int ad = graph.insertEdge(a, d, 5);
+    REQUIRE(graph.areAdjacent(a, d));
+    REQUIRE(graph.areAdjacent(d, a) == !graph.isDirected());
+    REQUIRE(graph.numEdges() == 3);
+    checkIncidenceIndex(graph);
+
+    graph.removeEdge(loop);
+    graph.removeEdge(ca);
+    REQUIRE(graph.numEdges() == 1);
+    REQUIRE(graph.showEdges() == std::vector<int>{ad});
+    checkIncidenceIndex(graph);
+}
+
+// Zapytania indeksu bitowego porownane z nastepnikami wyliczonymi z list krawedzi
+void checkAdjacencyBitset(const AdjacencyListGraph& graph)
+{
+    // Identyfikatory ponownie uzytych slotow maja bity generacji, wiec macierz jest po pozycjach w ids
+    std::vector<int> ids = graph.showVertices();
+    std::unordered_map<int, std::size_t> positions;
+    for(std::size_t i = 0; i < ids.size(); ++i)
+    {
+        positions[ids[i]] = i;
+    }
+    std::vector<std::vector<bool>> successors(ids.size(), std::vector<bool>(ids.size(), false));
+    for(std::size_t i = 0; i < ids.size(); ++i)
+    {
+        graph.forEachOutNeighbor(ids[i], [&](int u, int, int) { successors[i][positions.at(u)] = true; });
+    }
+
+    for(std::size_t i = 0; i < ids.size(); ++i)
+    {
+        for(std::size_t j = i % 5; j < ids.size(); j += 5)
+        {
+            int v1 = ids[i], v2 = ids[j];
+            INFO("Checking bitset queries for " << v1 << ", " << v2);
+            std::vector<int> common;
+            int unionCount = 0;
+            for(std::size_t k = 0; k < ids.size(); ++k)
+            {
+                if(successors[i][k] && successors[j][k])
+                    common.push_back(ids[k]);
+                unionCount += successors[i][k] || successors[j][k];
+            }
+            REQUIRE(graph.areAdjacent(v1, v2) == successors[i][j]);
+            REQUIRE(graph.commonNeighborCount(v1, v2) == static_cast<int>(common.size()));
+            REQUIRE(graph.neighborUnionCount(v1, v2) == unionCount);
+            REQUIRE(graph.commonNeighbors(v1, v2) == common);
+        }
+    }
+}
+
+TEST_CASE("Adjacency List Graph -- adjacency bitset")
+{
+    auto direction = GENERATE(EdgeDirection::Directed, EdgeDirection::Undirected);
+    AdjacencyListGraph graph{direction};
+    REQUIRE_THROWS_AS(graph.commonNeighborCount(0, 0), std::logic_error);
+
+    // Wiersze po 5 slow: petla wektorowa (4 slowa naraz) i koncowka skalarna
+    std::mt19937 random(2024);
+    int first = graph.insertVertices(300);
+    std::uniform_int_distribution<int> vertex(first, first + 299);
+    for(int i = 0; i < 3000; ++i)
+    {
+        graph.insertEdge(vertex(random), vertex(random), 1);
+    }
+    graph.enableAdjacencyBitset();
+    REQUIRE(graph.hasAdjacencyBitset());
+    for(int i = 0; i < 1000; ++i)
+    {
+        graph.insertEdge(vertex(random), vertex(random), 1);
+    }
+    std::vector<Graph::EdgeInput> batch{{first, first + 299, 1}, {first + 7, first + 7, 1}};
+    graph.insertEdges(batch);
+    checkAdjacencyBitset(graph);
+
+    // Usuniecie jednej z krawedzi rownoleglych zostawia bit, usuniecie drugiej go czysci
+    int a = first + 10, b = first + 250;
+    for(int e : graph.incidentEdges(a))
+    {
+        if(graph.opposite(a, e) == b)
+            graph.removeEdge(e);
+    }
+    int e1 = graph.insertEdge(a, b, 1);
+    int e2 = graph.insertEdge(a, b, 2);
+    graph.removeEdge(e1);
+    REQUIRE(graph.areAdjacent(a, b));
+    REQUIRE(graph.areAdjacent(b, a) == !graph.isDirected());
+    graph.removeEdge(e2);
+    REQUIRE_FALSE(graph.areAdjacent(a, b));
+    REQUIRE_FALSE(graph.areAdjacent(b, a));
+
+    // Usuniety wierzcholek znika z wierszy i kolumn; nastepny wierzcholek w tym slocie nie ma sasiadow
+    graph.removeVertex(first + 7);
+    graph.removeVertex(first + 100);
+    checkAdjacencyBitset(graph);
+    int reused = graph.insertVertex();
+    for(int v : graph.showVertices())
+    {
+        REQUIRE_FALSE(graph.areAdjacent(v, reused));
+        REQUIRE_FALSE(graph.areAdjacent(reused, v));
+    }
+    graph.insertEdge(reused, first, 1);
+    checkAdjacencyBitset(graph);
+
+    graph.disableAdjacencyBitset();
+    REQUIRE_THROWS_AS(graph.neighborUnionCount(first, first + 1), std::logic_error);
+    REQUIRE(graph.areAdjacent(reused, first));
+}
+
+TEST_CASE("Adjacency List Graph -- adjacency bitset grows past 64 and 128 vertices")
+{
+    auto direction = GENERATE(EdgeDirection::Directed, EdgeDirection::Undirected);
+    AdjacencyListGraph graph{direction};
+    graph.enableAdjacencyBitset();
+
+    // Kazdy nowy wierzcholek laczy sie z kilkoma wczesniejszymi; bity musza przetrwac przepisanie wierszy
+    std::vector<int> ids;
+    for(int count = 1; count <= 200; ++count)
+    {
+        int v = graph.insertVertex();
+        ids.push_back(v);
+        for(int step : {1, 3, 64})
+        {
+            if(static_cast<int>(ids.size()) > step)
+                graph.insertEdge(v, ids[ids.size() - 1 - step], 1);
+        }
+        if(count == 63 || count == 64 || count == 65 || count == 127 || count == 128 || count == 129 ||
+           count == 200)
+        {
+            checkAdjacencyBitset(graph);
+        }
+    }
+    graph.insertVertices(70);
+    graph.insertEdge(ids.front(), graph.showVertices().back(), 1);
+    checkAdjacencyBitset(graph);
+}
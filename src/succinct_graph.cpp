@@ -0,0 +1,97 @@
+#include "graphs/succinct_graph.hpp"
+#include <algorithm>
+
+// Buduje graf z krawedzi podanych w kolejnosci wstawienia: po uporzadkowaniu krawedzi (assignEdges) koduje
+// klucze krawedzi, poczatki zakresow i posortowane klucze odwrotne Eliasem-Fano.
+// Złożoność czasowa: O(V + E log E), pamięciowa: O(V + E)
+template <typename W>
+std::unique_ptr<BasicSuccinctGraph<W>> BasicSuccinctGraph<W>::build(std::vector<int> ids,
+                                                                    const std::vector<int>& sources,
+                                                                    const std::vector<int>& targets,
+                                                                    const std::vector<W>& weights)
+{
+    auto graph = std::make_unique<BasicSuccinctGraph<W>>();
+    std::vector<int> offsets;
+    std::vector<int> order = graph->assignEdges(std::move(ids), sources, targets, weights, offsets);
+    int n = graph->vertexCount;
+    int m = graph->edgeCount;
+
+    std::vector<std::uint64_t> keys(m);
+    for(int e = 0; e < m; ++e)
+    {
+        keys[e] = graph->key(sources[order[e]], targets[order[e]]);
+    }
+
+    graph->edgeKeys = EliasFano(keys, static_cast<std::uint64_t>(n) * n);
+
+    for(int e = 0; e < m; ++e)
+    {
+        keys[e] = graph->key(targets[order[e]], sources[order[e]]);
+    }
+    std::sort(keys.begin(), keys.end());
+    graph->inKeys = EliasFano(keys, static_cast<std::uint64_t>(n) * n);
+    graph->edgeOffsets = EliasFano(std::vector<std::uint64_t>(offsets.begin(), offsets.end()),
+                                   static_cast<std::uint64_t>(m) + 1);
+    return graph;
+}
+
+// Wierzcholek, do ktorego zakresu identyfikatorow krawedzi nalezy e: ostatni poczatek zakresu <= e.
+// Złożoność czasowa: O(1) oczekiwana, pamięciowa: O(1)
+template <typename W>
+int BasicSuccinctGraph<W>::sourceIndex(int e) const
+{
+    return static_cast<int>(edgeOffsets.lowerBound(static_cast<std::uint64_t>(e) + 1)) - 1;
+}
+
+// Złożoność czasowa: O(1), pamięciowa: O(1)
+template <typename W>
+std::size_t BasicSuccinctGraph<W>::memoryUsage() const
+{
+    return this->sharedMemoryUsage() + edgeOffsets.memoryUsage() + edgeKeys.memoryUsage() + inKeys.memoryUsage();
+}
+
+// Złożoność czasowa: O(d_in) oczekiwana, pamięciowa: O(d_in)
+template <typename W>
+std::vector<int> BasicSuccinctGraph<W>::inEdges(int v) const
+{
+    std::vector<int> result;
+    forEachInNeighbor(v, [&result](int, int e, W) { result.push_back(e); });
+    return result;
+}
+
+// Pierwszy klucz nie mniejszy od klucza (v1, v2) jest kluczem tej krawedzi, jesli ona istnieje.
+// Złożoność czasowa: O(1) oczekiwana, pamięciowa: O(1)
+template <typename W>
+bool BasicSuccinctGraph<W>::areAdjacent(int v1, int v2) const
+{
+    std::uint64_t wanted = key(this->indexOf(v1), this->indexOf(v2));
+    std::size_t e = edgeKeys.lowerBound(wanted);
+    return e < edgeKeys.size() && edgeKeys[e] == wanted;
+}
+
+// Poczatki krawedzi do v to zakres kluczy odwrotnych od v * V. Krawedz z w do v ma identyfikator rowny
+// pozycji klucza (w, v) w ciagu kluczy krawedzi; k-ta krawedz wielokrotna z w lezy k pozycji dalej.
+// Złożoność czasowa: O(d_in) oczekiwana, pamięciowa: O(1)
+template <typename W>
+void BasicSuccinctGraph<W>::forEachInNeighbor(int v, typename BasicGraph<W>::NeighborVisitor visit) const
+{
+    int u = this->indexOf(v);
+    std::uint64_t base = key(u, 0);
+    std::size_t begin = inKeys.lowerBound(base);
+    std::size_t end = inKeys.lowerBound(base + this->vertexCount);
+    auto cursor = inKeys.cursor(begin);
+    int previous = -1;
+    int e = 0;
+    for(std::size_t i = begin; i < end; ++i)
+    {
+        int w = static_cast<int>(cursor.next() - base);
+        e = w == previous ? e + 1 : static_cast<int>(edgeKeys.lowerBound(key(w, u)));
+        previous = w;
+        visit(this->vertexIds[w], e, this->weight(e));
+    }
+}
+
+#define GRAPHS_INSTANTIATE_SUCCINCT_GRAPH(W)                                                                           \
+    template class BasicReadOnlyGraph<BasicSuccinctGraph<W>, W>;                                                       \
+    template class BasicSuccinctGraph<W>;
+GRAPHS_FOR_EACH_WEIGHT(GRAPHS_INSTANTIATE_SUCCINCT_GRAPH)